@@ -0,0 +1,51 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+// Reference bandwidths for the roofline comparison of every other benchmark in this suite
+
+static auto bench_memcpy(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const std::vector<kstd::u8> source(state.range(0), 1);
+    std::vector<kstd::u8> destination(state.range(0), 0);
+    for(auto _ : state) {
+        std::memcpy(destination.data(), source.data(), source.size());
+        benchmark::ClobberMemory();
+    }
+    bench::set_throughput<kstd::u8>(state);
+}
+
+static auto bench_memset(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    std::vector<kstd::u8> destination(state.range(0), 0);
+    kstd::u8 value = 0;
+    for(auto _ : state) {
+        std::memset(destination.data(), ++value, destination.size());
+        benchmark::ClobberMemory();
+    }
+    bench::set_throughput<kstd::u8>(state);
+}
+
+BENCHMARK(bench_memcpy)->Apply(kstd::streams::bench::apply_cache_sweep<kstd::u8>);
+BENCHMARK(bench_memset)->Apply(kstd::streams::bench::apply_cache_sweep<kstd::u8>);
\ No newline at end of file
@@ -0,0 +1,74 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <kstd/streams/stream.hpp>
+#include <ranges>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+template<typename T>
+static auto bench_collect_map_stream(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        // clang-format off
+        auto result = stream(values).template collect_map<std::unordered_map>(
+            [](auto& value) { return value; },
+            [](auto& value) { return value * 2; });
+        // clang-format on
+        benchmark::DoNotOptimize(result.size());
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_collect_map_loop(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        std::unordered_map<T, T> result {};
+        for(const auto& value : values) {
+            result[value] = value * 2;
+        }
+        benchmark::DoNotOptimize(result.size());
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_collect_map_ranges(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        std::unordered_map<T, T> result {};
+        for(const auto& [key, value] :
+            values | std::views::transform([](auto& value) { return std::pair {value, value * 2}; })) {
+            result[key] = value;
+        }
+        benchmark::DoNotOptimize(result.size());
+    }
+    bench::set_throughput<T>(state);
+}
+
+KSTD_STREAMS_BENCHMARK(bench_collect_map_stream);
+KSTD_STREAMS_BENCHMARK(bench_collect_map_loop);
+KSTD_STREAMS_BENCHMARK(bench_collect_map_ranges);
\ No newline at end of file
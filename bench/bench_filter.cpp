@@ -0,0 +1,77 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <kstd/streams/stream.hpp>
+#include <ranges>
+
+#include "benchmark_utils.hpp"
+
+template<typename T>
+static auto bench_filter_stream(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    constexpr auto threshold = static_cast<T>(bench::max_value >> 1);
+    for(auto _ : state) {
+        // clang-format off
+        auto result = stream(values)
+            .filter([threshold](auto& value) { return value < threshold; })
+            .sum();
+        // clang-format on
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_filter_loop(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    constexpr auto threshold = static_cast<T>(bench::max_value >> 1);
+    for(auto _ : state) {
+        T result {};
+        for(const auto& value : values) {
+            if(value < threshold) {
+                result += value;
+            }
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_filter_ranges(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    constexpr auto threshold = static_cast<T>(bench::max_value >> 1);
+    for(auto _ : state) {
+        T result {};
+        for(const auto& value : values | std::views::filter([threshold](auto& value) { return value < threshold; })) {
+            result += value;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+KSTD_STREAMS_BENCHMARK(bench_filter_stream);
+KSTD_STREAMS_BENCHMARK(bench_filter_loop);
+KSTD_STREAMS_BENCHMARK(bench_filter_ranges);
\ No newline at end of file
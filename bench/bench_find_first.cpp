@@ -0,0 +1,72 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <kstd/streams/stream.hpp>
+#include <ranges>
+
+#include "benchmark_utils.hpp"
+
+// Searches for a value past the end of the data, so every benchmark scans the whole input
+template<typename T>
+static auto bench_find_first_stream(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    constexpr auto needle = static_cast<T>(bench::max_value);
+    for(auto _ : state) {
+        auto result = stream(values).find_first([needle](auto& value) { return value == needle; });
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_find_first_loop(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    constexpr auto needle = static_cast<T>(bench::max_value);
+    for(auto _ : state) {
+        const T* result = nullptr;
+        for(const auto& value : values) {
+            if(value == needle) {
+                result = &value;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_find_first_ranges(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    constexpr auto needle = static_cast<T>(bench::max_value);
+    for(auto _ : state) {
+        auto result = std::ranges::find_if(values, [needle](auto& value) { return value == needle; });
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+KSTD_STREAMS_BENCHMARK(bench_find_first_stream);
+KSTD_STREAMS_BENCHMARK(bench_find_first_loop);
+KSTD_STREAMS_BENCHMARK(bench_find_first_ranges);
\ No newline at end of file
@@ -0,0 +1,72 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <kstd/streams/stream.hpp>
+#include <ranges>
+
+#include "benchmark_utils.hpp"
+
+template<typename T>
+static auto bench_map_stream(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        // clang-format off
+        auto result = stream(values)
+            .map([](auto& value) { return value * 3; })
+            .sum();
+        // clang-format on
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_map_loop(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        T result {};
+        for(const auto& value : values) {
+            result += value * 3;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_map_ranges(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        T result {};
+        for(const auto value : values | std::views::transform([](auto& value) { return value * 3; })) {
+            result += value;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+KSTD_STREAMS_BENCHMARK(bench_map_stream);
+KSTD_STREAMS_BENCHMARK(bench_map_loop);
+KSTD_STREAMS_BENCHMARK(bench_map_ranges);
\ No newline at end of file
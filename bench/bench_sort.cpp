@@ -0,0 +1,69 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <kstd/streams/stream.hpp>
+#include <ranges>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+template<typename T>
+static auto bench_sort_stream(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        auto result = stream(values).sort().template collect<std::vector>(collectors::push_back);
+        benchmark::DoNotOptimize(result.data());
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_sort_loop(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        std::vector<T> result {};
+        for(const auto& value : values) {
+            result.push_back(value);
+        }
+        std::sort(result.begin(), result.end());
+        benchmark::DoNotOptimize(result.data());
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_sort_ranges(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        std::vector<T> result {};
+        std::ranges::copy(values, std::back_inserter(result));
+        std::ranges::sort(result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    bench::set_throughput<T>(state);
+}
+
+KSTD_STREAMS_BENCHMARK(bench_sort_stream);
+KSTD_STREAMS_BENCHMARK(bench_sort_loop);
+KSTD_STREAMS_BENCHMARK(bench_sort_ranges);
\ No newline at end of file
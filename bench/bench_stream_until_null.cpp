@@ -0,0 +1,91 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <kstd/streams/stream.hpp>
+#include <memory>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+template<typename T>
+struct BenchLinkedList final {
+    T value;
+    BenchLinkedList* next;
+};
+
+// Nodes are linked in shuffled order so the traversal does not degrade into a sequential scan
+template<typename T>
+[[nodiscard]] static auto make_linked_list(kstd::usize size) -> std::vector<BenchLinkedList<T>> {
+    const auto values = kstd::streams::bench::make_values<T>(size);
+    std::vector<BenchLinkedList<T>> nodes(size);
+    std::vector<kstd::usize> order(size);
+
+    for(kstd::usize index = 0; index < size; ++index) {
+        nodes[index].value = values[index];
+        order[index] = index;
+    }
+
+    std::shuffle(order.begin() + 1, order.end(), std::mt19937 {kstd::streams::bench::seed});
+    for(kstd::usize index = 0; index + 1 < size; ++index) {
+        nodes[order[index]].next = &nodes[order[index + 1]];
+    }
+    nodes[order[size - 1]].next = nullptr;
+    return nodes;
+}
+
+template<typename T>
+static auto bench_stream_until_null_stream(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    auto nodes = make_linked_list<T>(state.range(0));
+    for(auto _ : state) {
+        // clang-format off
+        auto result = stream_until_null(nodes.data(), KSTD_PTR_FIELD_FUNCTOR(next))
+            .map(KSTD_FIELD_FUNCTOR(value))
+            .sum();
+        // clang-format on
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<BenchLinkedList<T>>(state);
+}
+
+template<typename T>
+static auto bench_stream_until_null_loop(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    auto nodes = make_linked_list<T>(state.range(0));
+    for(auto _ : state) {
+        T result {};
+        for(auto* node = nodes.data(); node != nullptr; node = node->next) {
+            result += node->value;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<BenchLinkedList<T>>(state);
+}
+
+// The working set is made of nodes rather than values, so the sweep is sized by the node
+#define KSTD_STREAMS_LINKED_LIST_BENCHMARK(n)                                                                          \
+    BENCHMARK_TEMPLATE(n, kstd::u32)->Apply(kstd::streams::bench::apply_cache_sweep<BenchLinkedList<kstd::u32>>);      \
+    BENCHMARK_TEMPLATE(n, kstd::u64)->Apply(kstd::streams::bench::apply_cache_sweep<BenchLinkedList<kstd::u64>>);      \
+    BENCHMARK_TEMPLATE(n, kstd::f64)->Apply(kstd::streams::bench::apply_cache_sweep<BenchLinkedList<kstd::f64>>)
+
+// There is no std::ranges equivalent for walking an intrusive linked list
+KSTD_STREAMS_LINKED_LIST_BENCHMARK(bench_stream_until_null_stream);
+KSTD_STREAMS_LINKED_LIST_BENCHMARK(bench_stream_until_null_loop);
\ No newline at end of file
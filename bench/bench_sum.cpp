@@ -0,0 +1,89 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <functional>
+#include <kstd/streams/stream.hpp>
+#include <numeric>
+#include <ranges>
+
+#include "benchmark_utils.hpp"
+
+template<typename T>
+static auto bench_sum_stream(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        auto result = stream(values).sum();
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+template<typename T>
+static auto bench_sum_loop(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        T result {};
+        for(const auto& value : values) {
+            result += value;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+
+#ifdef __cpp_lib_ranges_fold
+template<typename T>
+static auto bench_sum_ranges(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        auto result = std::ranges::fold_left(std::views::all(values), T {}, std::plus<> {});
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+#else
+// Without std::ranges::fold_left (C++23) this measures a view's iterators driving std::accumulate
+template<typename T>
+static auto bench_sum_ranges_accumulate(benchmark::State& state) -> void {
+    using namespace kstd::streams;
+    const auto values = bench::make_values<T>(state.range(0));
+    for(auto _ : state) {
+        const auto view = std::views::all(values);
+        auto result = std::accumulate(std::ranges::begin(view), std::ranges::end(view), T {});
+        benchmark::DoNotOptimize(result);
+    }
+    bench::set_throughput<T>(state);
+}
+#endif
+
+KSTD_STREAMS_BENCHMARK(bench_sum_stream);
+KSTD_STREAMS_BENCHMARK(bench_sum_loop);
+#ifdef __cpp_lib_ranges_fold
+KSTD_STREAMS_BENCHMARK(bench_sum_ranges);
+#else
+KSTD_STREAMS_BENCHMARK(bench_sum_ranges_accumulate);
+#endif
+
+KSTD_STREAMS_THREADED_BENCHMARK(bench_sum_stream);
+KSTD_STREAMS_THREADED_BENCHMARK(bench_sum_loop);
\ No newline at end of file
@@ -0,0 +1,143 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstring>
+#include <kstd/types.hpp>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define KSTD_STREAMS_BENCHMARK(n)                                                                                      \
+    BENCHMARK_TEMPLATE(n, kstd::u32)->Apply(kstd::streams::bench::apply_cache_sweep<kstd::u32>);                       \
+    BENCHMARK_TEMPLATE(n, kstd::u64)->Apply(kstd::streams::bench::apply_cache_sweep<kstd::u64>);                       \
+    BENCHMARK_TEMPLATE(n, kstd::f64)->Apply(kstd::streams::bench::apply_cache_sweep<kstd::f64>)
+
+#define KSTD_STREAMS_THREADED_BENCHMARK(n)                                                                             \
+    BENCHMARK_TEMPLATE(n, kstd::u32)->Apply(kstd::streams::bench::apply_thread_sweep<kstd::u32>)->UseRealTime();       \
+    BENCHMARK_TEMPLATE(n, kstd::u64)->Apply(kstd::streams::bench::apply_thread_sweep<kstd::u64>)->UseRealTime();       \
+    BENCHMARK_TEMPLATE(n, kstd::f64)->Apply(kstd::streams::bench::apply_thread_sweep<kstd::f64>)->UseRealTime()
+
+namespace kstd::streams::bench {
+    constexpr u32 max_value = 1 << 16;
+    constexpr u32 seed = 1337;
+    constexpr usize min_sweep_bytes = 1 << 12;
+    constexpr usize fallback_cache_bytes = 1 << 25;
+    constexpr usize max_sweep_bytes = 1 << 28;
+    constexpr usize min_reference_bytes = 1 << 28;
+
+    /**
+     * The size of the largest cache reported by the machine running the benchmarks.
+     */
+    [[nodiscard]] inline auto get_last_level_cache_size() -> usize {
+        const auto& caches = benchmark::CPUInfo::Get().caches;
+        if(caches.empty()) {
+            return fallback_cache_bytes;
+        }
+        const auto& last_level = *std::max_element(caches.cbegin(), caches.cend(), [](auto& lhs, auto& rhs) {
+            return lhs.size < rhs.size;
+        });
+        return static_cast<usize>(last_level.size);
+    }
+
+    /**
+     * Sweeps the working set from L1-resident up to four times the last level cache,
+     * so the results show where each stage falls off as data moves out to DRAM.
+     */
+    template<typename T>
+    auto apply_cache_sweep(benchmark::internal::Benchmark* benchmark) -> void {
+        const auto max_bytes = std::min(get_last_level_cache_size() << 2, max_sweep_bytes);
+        for(auto bytes = min_sweep_bytes; bytes <= max_bytes; bytes <<= 1) {
+            benchmark->Arg(static_cast<i64>(bytes / sizeof(T)));
+        }
+    }
+
+    /**
+     * Runs independent copies of a benchmark on 1..N threads with a DRAM-resident working set
+     * per thread, which shows how a stage scales once threads compete for memory bandwidth.
+     */
+    template<typename T>
+    auto apply_thread_sweep(benchmark::internal::Benchmark* benchmark) -> void {
+        const auto max_threads = static_cast<i32>(std::max(std::thread::hardware_concurrency(), 1U));
+        const auto bytes = std::min(get_last_level_cache_size() << 1, max_sweep_bytes);
+        benchmark->Arg(static_cast<i64>(bytes / sizeof(T)));
+        benchmark->ThreadRange(1, max_threads);
+    }
+
+    /**
+     * Measures the memcpy bandwidth of this machine for a working set of the given size.
+     * Results are cached, so every size is only measured once per process.
+     */
+    [[nodiscard]] inline auto get_memcpy_bandwidth(usize bytes) -> f64 {
+        static std::mutex mutex {};
+        static std::unordered_map<usize, f64> bandwidths {};
+        const std::lock_guard lock {mutex};
+
+        if(const auto bandwidth = bandwidths.find(bytes); bandwidth != bandwidths.end()) {
+            return bandwidth->second;
+        }
+
+        std::vector<u8> source(bytes, 1);
+        std::vector<u8> destination(bytes, 0);
+        const auto repetitions = std::max<usize>(min_reference_bytes / bytes, 4);
+        std::memcpy(destination.data(), source.data(), bytes);
+
+        const auto start = std::chrono::steady_clock::now();
+        for(usize index = 0; index < repetitions; ++index) {
+            std::memcpy(destination.data(), source.data(), bytes);
+            benchmark::ClobberMemory();
+        }
+        const std::chrono::duration<f64> seconds = std::chrono::steady_clock::now() - start;
+        const auto bandwidth = static_cast<f64>(bytes * repetitions) / seconds.count();
+        bandwidths[bytes] = bandwidth;
+        return bandwidth;
+    }
+
+    template<typename T>
+    [[nodiscard]] auto make_values(usize size, u32 bound = max_value) -> std::vector<T> {
+        std::mt19937 generator {seed};
+        std::uniform_int_distribution<u32> distribution {0, bound - 1};
+        std::vector<T> values {};
+        values.reserve(size);
+        for(usize index = 0; index < size; ++index) {
+            values.push_back(static_cast<T>(distribution(generator)));
+        }
+        return values;
+    }
+
+    /**
+     * Reports elements/s and bytes/s, along with the achieved fraction of the
+     * memcpy bandwidth for the same working set as a roofline reference.
+     */
+    template<typename T>
+    auto set_throughput(benchmark::State& state) -> void {
+        const auto bytes = static_cast<usize>(state.range(0)) * sizeof(T);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * static_cast<i64>(bytes));
+        state.counters["memcpy_fraction"] = benchmark::Counter {static_cast<f64>(bytes) / get_memcpy_bandwidth(bytes),
+                                                                benchmark::Counter::kIsIterationInvariantRate};
+    }
+}// namespace kstd::streams::bench
\ No newline at end of file
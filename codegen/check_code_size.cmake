@@ -0,0 +1,58 @@
+# Compares the size of every kstd_codegen_stream_<name> symbol in OBJECT with its
+# kstd_codegen_loop_<name> counterpart and fails when the ratio exceeds the tolerance
+# given for <name> in TOLERANCES, a list of <name>=<percent> or <name>=xfail entries.
+#
+# cmake -DNM=<nm> -DOBJECT=<object file> "-DTOLERANCES=<name>=<percent>;..." -P check_code_size.cmake
+
+execute_process(
+    COMMAND ${NM} --print-size --defined-only ${OBJECT}
+    OUTPUT_VARIABLE SYMBOLS
+    RESULT_VARIABLE RESULT)
+if (NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Could not list symbols of ${OBJECT}")
+endif ()
+
+string(REPLACE "\n" ";" SYMBOLS "${SYMBOLS}")
+foreach (LINE IN LISTS SYMBOLS)
+    # Mach-O prefixes C symbols with an underscore
+    if (LINE MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tT] _?kstd_codegen_(stream|loop)_([a-z_]+)$")
+        math(EXPR SIZE "0x${CMAKE_MATCH_1}")
+        set(SIZE_${CMAKE_MATCH_2}_${CMAKE_MATCH_3} ${SIZE})
+        list(APPEND NAMES ${CMAKE_MATCH_3})
+    endif ()
+endforeach ()
+
+foreach (ENTRY IN LISTS TOLERANCES)
+    if (ENTRY MATCHES "^([a-z_]+)=([0-9]+|xfail)$")
+        set(TOLERANCE_${CMAKE_MATCH_1} ${CMAKE_MATCH_2})
+    else ()
+        message(FATAL_ERROR "Invalid tolerance ${ENTRY}")
+    endif ()
+endforeach ()
+
+list(REMOVE_DUPLICATES NAMES)
+if (NOT NAMES)
+    message(FATAL_ERROR "No codegen symbols found in ${OBJECT}")
+endif ()
+
+set(FAILED OFF)
+foreach (NAME IN LISTS NAMES)
+    set(STREAM_SIZE ${SIZE_stream_${NAME}})
+    set(LOOP_SIZE ${SIZE_loop_${NAME}})
+    set(TOLERANCE ${TOLERANCE_${NAME}})
+    math(EXPR RATIO "${STREAM_SIZE} * 100 / ${LOOP_SIZE}")
+    message(STATUS "${NAME}: stream ${STREAM_SIZE} bytes, loop ${LOOP_SIZE} bytes, ratio ${RATIO}%")
+    if (NOT DEFINED TOLERANCE)
+        message(SEND_ERROR "${NAME} has no code size tolerance")
+        set(FAILED ON)
+    elseif (TOLERANCE STREQUAL "xfail")
+        message(STATUS "${NAME} is an expected failure")
+    elseif (RATIO GREATER TOLERANCE)
+        message(SEND_ERROR "${NAME} exceeds the code size tolerance of ${TOLERANCE}%")
+        set(FAILED ON)
+    endif ()
+endforeach ()
+
+if (FAILED)
+    message(FATAL_ERROR "Code size regression detected")
+endif ()
\ No newline at end of file
@@ -0,0 +1,139 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include "codegen_pipelines.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <kstd/streams/perf_counters.hpp>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    constexpr kstd::i32 exit_skipped = 77;
+    constexpr kstd::usize num_values = 4096;
+    constexpr kstd::usize num_iterations = 64;
+
+    template<typename F>
+    [[nodiscard]] auto count_instructions(F&& function) noexcept -> kstd::Option<kstd::u64> {
+        kstd::streams::profiling::PerfCounters counters {};
+        counters.start();
+        for(kstd::usize iteration = 0; iteration < num_iterations; ++iteration) {
+            function();
+        }
+        return counters.stop().instructions;
+    }
+
+    // An empty tolerance marks an expected failure, which is reported but never fails the check
+    using Tolerances = std::map<std::string, kstd::Option<kstd::usize>, std::less<>>;
+
+    // Parses <name>=<percent> and <name>=xfail arguments
+    [[nodiscard]] auto parse_tolerances(int argc, char** argv) -> Tolerances {
+        Tolerances tolerances {};
+        for(int index = 1; index < argc; ++index) {
+            const std::string_view argument {argv[index]};// NOLINT
+            const auto separator = argument.find('=');
+            if(separator == std::string_view::npos) {
+                continue;
+            }
+            const auto value = argument.substr(separator + 1);
+            auto& tolerance = tolerances[std::string {argument.substr(0, separator)}];
+            if(value != "xfail") {
+                tolerance = static_cast<kstd::usize>(std::strtoul(std::string {value}.c_str(), nullptr, 10));
+            }
+        }
+        return tolerances;
+    }
+
+    template<typename S, typename L>
+    [[nodiscard]] auto compare(const char* name, const Tolerances& tolerances, S&& stream_function,
+                               L&& loop_function) noexcept -> bool {
+        if(stream_function() != loop_function()) {
+            std::printf("%-20s stream and loop disagree on the result\n", name);
+            return false;
+        }
+        const auto tolerance = tolerances.find(std::string_view {name});
+        if(tolerance == tolerances.cend()) {
+            std::printf("%-20s has no instruction tolerance\n", name);
+            return false;
+        }
+        const auto stream_instructions = count_instructions(stream_function);
+        const auto loop_instructions = count_instructions(loop_function);
+        const auto ratio = *stream_instructions * 100 / *loop_instructions;
+        const auto is_expected_failure = !tolerance->second;
+        const auto is_within_tolerance = is_expected_failure || ratio <= *tolerance->second;
+        std::printf("%-20s stream %12llu loop %12llu ratio %llu%%%s\n", name,
+                    static_cast<unsigned long long>(*stream_instructions),// NOLINT
+                    static_cast<unsigned long long>(*loop_instructions),  // NOLINT
+                    static_cast<unsigned long long>(ratio),               // NOLINT
+                    is_expected_failure ? " (expected failure)" : is_within_tolerance ? "" : " (exceeds tolerance)");
+        return is_within_tolerance;
+    }
+}// namespace
+
+/*
+ * Compares the instructions retired by every stream pipeline in codegen_pipelines.cpp
+ * with its hand written loop, failing when the ratio exceeds the tolerance in percent
+ * given for the pipeline as <name>=<percent>, or <name>=xfail for an expected failure.
+ * Exits with 77 (reported as skipped by CTest) when the instruction counter is not
+ * accessible, which is common inside containers.
+ */
+auto main(int argc, char** argv) -> int {
+    const auto tolerances = parse_tolerances(argc, argv);
+
+    if(!kstd::streams::profiling::PerfCounters {}.stop().instructions) {
+        std::printf("Instruction counter is not available, skipping\n");
+        return exit_skipped;
+    }
+
+    std::vector<kstd::u32> values(num_values);
+    for(kstd::usize index = 0; index < num_values; ++index) {
+        values[index] = static_cast<kstd::u32>((index * 7919) % 1021);
+    }
+    std::vector<KstdCodegenNode> nodes(num_values);
+    for(kstd::usize index = 0; index < num_values; ++index) {
+        nodes[index] = {values[index], index + 1 < num_values ? &nodes[index + 1] : nullptr};
+    }
+
+    const auto* data = values.data();
+    const auto needle = values[num_values - 1];
+    auto is_passing = true;
+
+    // clang-format off
+    is_passing &= compare("filter_map_sum", tolerances,
+                          [&] { return kstd_codegen_stream_filter_map_sum(data, num_values); },
+                          [&] { return kstd_codegen_loop_filter_map_sum(data, num_values); });
+    is_passing &= compare("map_sum", tolerances,
+                          [&] { return kstd_codegen_stream_map_sum(data, num_values); },
+                          [&] { return kstd_codegen_loop_map_sum(data, num_values); });
+    is_passing &= compare("filter_count", tolerances,
+                          [&] { return kstd_codegen_stream_filter_count(data, num_values); },
+                          [&] { return kstd_codegen_loop_filter_count(data, num_values); });
+    is_passing &= compare("find_first", tolerances,
+                          [&] { return kstd_codegen_stream_find_first(data, num_values, needle); },
+                          [&] { return kstd_codegen_loop_find_first(data, num_values, needle); });
+    is_passing &= compare("linked_sum", tolerances,
+                          [&] { return kstd_codegen_stream_linked_sum(nodes.data()); },
+                          [&] { return kstd_codegen_loop_linked_sum(nodes.data()); });
+    // clang-format on
+
+    return is_passing ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include "codegen_pipelines.hpp"
+#include <kstd/streams/stream.hpp>
+#include <span>
+
+using namespace kstd::streams;
+
+auto kstd_codegen_stream_filter_map_sum(const kstd::u32* data, kstd::usize size) noexcept -> kstd::u32 {
+    const std::span<const kstd::u32> values {data, size};
+    return stream(values).filter(filters::even).map([](auto value) { return value * 3; }).sum();
+}
+
+auto kstd_codegen_loop_filter_map_sum(const kstd::u32* data, kstd::usize size) noexcept -> kstd::u32 {
+    kstd::u32 result = 0;
+    for(kstd::usize index = 0; index < size; ++index) {
+        if((data[index] & 1) == 0) {
+            result += data[index] * 3;
+        }
+    }
+    return result;
+}
+
+auto kstd_codegen_stream_map_sum(const kstd::u32* data, kstd::usize size) noexcept -> kstd::u32 {
+    const std::span<const kstd::u32> values {data, size};
+    return stream(values).map([](auto value) { return value * 3; }).sum();
+}
+
+auto kstd_codegen_loop_map_sum(const kstd::u32* data, kstd::usize size) noexcept -> kstd::u32 {
+    kstd::u32 result = 0;
+    for(kstd::usize index = 0; index < size; ++index) {
+        result += data[index] * 3;
+    }
+    return result;
+}
+
+auto kstd_codegen_stream_filter_count(const kstd::u32* data, kstd::usize size) noexcept -> kstd::usize {
+    const std::span<const kstd::u32> values {data, size};
+    return stream(values).filter(filters::even).count();
+}
+
+auto kstd_codegen_loop_filter_count(const kstd::u32* data, kstd::usize size) noexcept -> kstd::usize {
+    kstd::usize result = 0;
+    for(kstd::usize index = 0; index < size; ++index) {
+        if((data[index] & 1) == 0) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+auto kstd_codegen_stream_find_first(const kstd::u32* data, kstd::usize size, kstd::u32 needle) noexcept
+        -> const kstd::u32* {
+    const std::span<const kstd::u32> values {data, size};
+    const auto result = stream(values).find_first([needle](const auto& value) { return value == needle; });
+    return result ? &*result : nullptr;
+}
+
+auto kstd_codegen_loop_find_first(const kstd::u32* data, kstd::usize size, kstd::u32 needle) noexcept
+        -> const kstd::u32* {
+    for(kstd::usize index = 0; index < size; ++index) {
+        if(data[index] == needle) {
+            return &data[index];
+        }
+    }
+    return nullptr;
+}
+
+auto kstd_codegen_stream_linked_sum(const KstdCodegenNode* head) noexcept -> kstd::u32 {
+    return stream_until_null(head, KSTD_PTR_FIELD_FUNCTOR(next))
+            .map([](const auto& node) { return node.value; })
+            .sum();
+}
+
+auto kstd_codegen_loop_linked_sum(const KstdCodegenNode* head) noexcept -> kstd::u32 {
+    kstd::u32 result = 0;
+    for(const auto* node = head; node != nullptr; node = node->next) {
+        result += node->value;
+    }
+    return result;
+}
\ No newline at end of file
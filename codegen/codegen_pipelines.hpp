@@ -0,0 +1,52 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/types.hpp>
+
+/*
+ * Every pipeline is implemented twice, once as a stream and once as the equivalent
+ * hand written loop. The symbols are extern "C" so the code size check can find the
+ * pairs by name in the object file: kstd_codegen_stream_<name> and kstd_codegen_loop_<name>.
+ */
+extern "C" {
+    struct KstdCodegenNode final {
+        kstd::u32 value;
+        KstdCodegenNode* next;
+    };
+
+    auto kstd_codegen_stream_filter_map_sum(const kstd::u32* data, kstd::usize size) noexcept -> kstd::u32;
+    auto kstd_codegen_loop_filter_map_sum(const kstd::u32* data, kstd::usize size) noexcept -> kstd::u32;
+
+    auto kstd_codegen_stream_map_sum(const kstd::u32* data, kstd::usize size) noexcept -> kstd::u32;
+    auto kstd_codegen_loop_map_sum(const kstd::u32* data, kstd::usize size) noexcept -> kstd::u32;
+
+    auto kstd_codegen_stream_filter_count(const kstd::u32* data, kstd::usize size) noexcept -> kstd::usize;
+    auto kstd_codegen_loop_filter_count(const kstd::u32* data, kstd::usize size) noexcept -> kstd::usize;
+
+    auto kstd_codegen_stream_find_first(const kstd::u32* data, kstd::usize size, kstd::u32 needle) noexcept
+            -> const kstd::u32*;
+    auto kstd_codegen_loop_find_first(const kstd::u32* data, kstd::usize size, kstd::u32 needle) noexcept
+            -> const kstd::u32*;
+
+    auto kstd_codegen_stream_linked_sum(const KstdCodegenNode* head) noexcept -> kstd::u32;
+    auto kstd_codegen_loop_linked_sum(const KstdCodegenNode* head) noexcept -> kstd::u32;
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+# Maximum stream to loop ratios in percent for every codegen pipeline, per optimization level.
+# The values are the ratios measured with GCC 12 on x86-64 plus about ten points of headroom,
+# so any regression in the generated code fails the check. Other compilers generate different
+# code, so they have no tolerances and the codegen tests are not added for them. Entries may
+# also be xfail, which only reports the ratio, for pipelines that can't be bounded at all.
+
+if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+    set(KSTD_STREAMS_CODEGEN_SIZE_O2
+        filter_map_sum=230
+        map_sum=165
+        filter_count=250
+        find_first=170
+        linked_sum=135)
+    set(KSTD_STREAMS_CODEGEN_INSTRUCTIONS_O2
+        filter_map_sum=145
+        map_sum=145
+        filter_count=145
+        find_first=125
+        linked_sum=135)
+
+    # The vectorized loops are larger than their streams, these only make sure the streams stay smaller
+    set(KSTD_STREAMS_CODEGEN_SIZE_O3
+        filter_map_sum=100
+        map_sum=100
+        filter_count=100
+        find_first=150
+        linked_sum=135)
+    # At -O3 GCC vectorizes the loops over arrays, while the pull-based get_next loop of a stream
+    # does not vectorize yet, so these streams retire three to four times the instructions
+    set(KSTD_STREAMS_CODEGEN_INSTRUCTIONS_O3
+        filter_map_sum=310
+        map_sum=410
+        filter_count=310
+        find_first=130
+        linked_sum=135)
+endif ()
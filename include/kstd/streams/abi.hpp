@@ -0,0 +1,33 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+/**
+ * Profiling changes the layout of every pipe, so all of kstd-streams lives in an inline
+ * namespace named after whether KSTD_STREAMS_PROFILING is defined. Translation units built
+ * with and without it instantiate distinct symbols instead of merging incompatible
+ * definitions, and handing streams from one to the other fails to link.
+ */
+#ifdef KSTD_STREAMS_PROFILING
+#define KSTD_STREAMS_ABI profiled
+#else
+#define KSTD_STREAMS_ABI unprofiled
+#endif
\ No newline at end of file
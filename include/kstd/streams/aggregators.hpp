@@ -0,0 +1,346 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <deque>
+#include <functional>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "abi.hpp"
+
+/*
+ * Aggregators maintain the result of a MaterializedView or a window. Each one creates
+ * an initial state for a given element type, and has to be able to both add an element
+ * to and remove an element from that state. Aggregators with a get_result function turn
+ * their state into the result, all others use the state itself.
+ *
+ * mean works everywhere, but min, max and fold can only remove their oldest element,
+ * so they only work for windows. They say so with removes_oldest_only, which
+ * materialized views reject.
+ *
+ * Sliding windows yield a result for every element, so they reject aggregators like collect,
+ * whose state would be copied as a whole every time, see HasCheapResult.
+ */
+namespace kstd::streams::inline KSTD_STREAMS_ABI::aggregators {
+    template<typename AGGREGATOR>
+    concept RemovesAnyElement = !requires { requires AGGREGATOR::removes_oldest_only; };
+
+    // Whether taking the result costs constant time, as sliding windows take it for every element
+    template<typename AGGREGATOR, typename T>
+    concept HasCheapResult =
+            requires(const AGGREGATOR& aggregator) { aggregator.get_result(aggregator.template make_state<T>()); } ||
+            std::is_trivially_copyable_v<decltype(std::declval<const AGGREGATOR&>().template make_state<T>())>;
+
+    // Whether elements can be kept in a std::unordered_multiset
+    template<typename T>
+    concept Hashable = std::equality_comparable<T> && requires(const T& value) {
+        { std::hash<T> {}(value) } -> std::convertible_to<usize>;
+    };
+
+    /**
+     * Keeps hashable elements in a hash multiset, so they can be removed in constant time but
+     * have no order. Any other elements are kept in a vector in the order they were added,
+     * so removing one of them costs linear time.
+     */
+    struct Collect final {
+        template<typename T>
+        using StateType = std::conditional_t<Hashable<T>, std::unordered_multiset<T>, std::vector<T>>;
+
+        template<typename T>
+        [[nodiscard]] auto make_state() const noexcept -> StateType<T> {
+            static_assert(std::equality_comparable<T>, "Collected elements need an operator== to be removed again");
+            return {};
+        }
+
+        template<typename T>
+        auto add(StateType<T>& state, const T& value) const -> void {
+            if constexpr(Hashable<T>) {
+                state.insert(value);
+            }
+            else {
+                state.push_back(value);
+            }
+        }
+
+        template<typename T>
+        auto remove(StateType<T>& state, const T& value) const noexcept -> void {
+            const auto element = [&] {
+                if constexpr(Hashable<T>) {
+                    return state.find(value);
+                }
+                else {
+                    return std::find(state.begin(), state.end(), value);
+                }
+            }();
+            if(element != state.end()) {
+                state.erase(element);
+            }
+        }
+    };
+
+    struct Sum final {
+        template<typename T>
+        [[nodiscard]] constexpr auto make_state() const noexcept -> T {
+            return T {};
+        }
+
+        template<typename T>
+        constexpr auto add(T& state, const T& value) const noexcept -> void {
+            state += value;
+        }
+
+        template<typename T>
+        constexpr auto remove(T& state, const T& value) const noexcept -> void {
+            state -= value;
+        }
+    };
+
+    struct Count final {
+        template<typename T>
+        [[nodiscard]] constexpr auto make_state() const noexcept -> usize {
+            return 0;
+        }
+
+        template<typename T>
+        constexpr auto add(usize& state, const T&) const noexcept -> void {
+            ++state;
+        }
+
+        template<typename T>
+        constexpr auto remove(usize& state, const T&) const noexcept -> void {
+            --state;
+        }
+    };
+
+    template<typename T>
+    struct GroupTotal final {
+        T sum;
+        usize count;
+    };
+
+    template<typename KM, typename VM>
+    struct GroupSum final {
+        private:
+        KM _key_mapper;
+        VM _value_mapper;
+
+        template<typename T>
+        using KeyType = std::decay_t<std::invoke_result_t<const KM&, const T&>>;
+
+        template<typename T>
+        using TotalType = GroupTotal<std::decay_t<std::invoke_result_t<const VM&, const T&>>>;
+
+        public:
+        constexpr GroupSum(KM key_mapper, VM value_mapper) noexcept :
+                _key_mapper {std::move(key_mapper)},
+                _value_mapper {std::move(value_mapper)} {
+        }
+
+        template<typename T>
+        [[nodiscard]] auto make_state() const noexcept -> std::unordered_map<KeyType<T>, TotalType<T>> {
+            return {};
+        }
+
+        template<typename T>
+        auto add(std::unordered_map<KeyType<T>, TotalType<T>>& state, const T& value) const noexcept -> void {
+            auto& total = state[_key_mapper(value)];
+            total.sum += _value_mapper(value);
+            ++total.count;
+        }
+
+        // Groups are dropped once their last element is removed
+        template<typename T>
+        auto remove(std::unordered_map<KeyType<T>, TotalType<T>>& state, const T& value) const noexcept -> void {
+            const auto group = state.find(_key_mapper(value));
+            if(group == state.end()) {
+                return;
+            }
+            auto& total = group->second;
+            total.sum -= _value_mapper(value);
+            if(--total.count == 0) {
+                state.erase(group);
+            }
+        }
+    };
+
+    template<typename T>
+    struct MeanState final {
+        T sum;
+        usize count;
+    };
+
+    struct Mean final {
+        template<typename T>
+        [[nodiscard]] constexpr auto make_state() const noexcept -> MeanState<T> {
+            return {T {}, 0};
+        }
+
+        template<typename T>
+        constexpr auto add(MeanState<T>& state, const T& value) const noexcept -> void {
+            state.sum += value;
+            ++state.count;
+        }
+
+        template<typename T>
+        constexpr auto remove(MeanState<T>& state, const T& value) const noexcept -> void {
+            state.sum -= value;
+            --state.count;
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr auto get_result(const MeanState<T>& state) const noexcept -> f64 {
+            return state.count == 0 ? 0.0 : static_cast<f64>(state.sum) / static_cast<f64>(state.count);
+        }
+    };
+
+    /*
+     * Keeps the elements which can still become the extremum in a monotonic deque,
+     * so adding and removing the oldest element take amortized constant time.
+     */
+    template<bool IS_MAX>
+    struct Extremum final {
+        static constexpr bool removes_oldest_only = true;
+
+        private:
+        template<typename T>
+        [[nodiscard]] static constexpr auto precedes(const T& a, const T& b) noexcept -> bool {
+            if constexpr(IS_MAX) {
+                return b < a;
+            }
+            else {
+                return a < b;
+            }
+        }
+
+        public:
+        template<typename T>
+        [[nodiscard]] auto make_state() const noexcept -> std::deque<T> {
+            return {};
+        }
+
+        template<typename T>
+        auto add(std::deque<T>& state, const T& value) const noexcept -> void {
+            while(!state.empty() && precedes(value, state.back())) {
+                state.pop_back();
+            }
+            state.push_back(value);
+        }
+
+        template<typename T>
+        auto remove(std::deque<T>& state, const T& value) const noexcept -> void {
+            if(!state.empty() && !precedes(state.front(), value)) {
+                state.pop_front();
+            }
+        }
+
+        template<typename T>
+        [[nodiscard]] auto get_result(const std::deque<T>& state) const noexcept -> T {
+            return state.front();
+        }
+    };
+
+    template<typename T>
+    struct FoldState final {
+        std::vector<std::pair<T, T>> front;// Oldest element on top, each with the fold of itself and all newer ones
+        std::vector<T> back;
+        Option<T> back_result;
+    };
+
+    /*
+     * Folds with any associative function using two stacks: new elements are pushed onto
+     * the back stack, and whenever the front stack runs empty, the back stack is moved over
+     * while folding from the newest element, so every element is folded at most twice.
+     */
+    template<typename F>
+    struct Fold final {
+        static constexpr bool removes_oldest_only = true;
+
+        private:
+        F _function;
+
+        public:
+        explicit constexpr Fold(F function) noexcept :
+                _function {std::move(function)} {
+        }
+
+        template<typename T>
+        [[nodiscard]] auto make_state() const noexcept -> FoldState<T> {
+            return {};
+        }
+
+        template<typename T>
+        auto add(FoldState<T>& state, const T& value) const noexcept -> void {
+            state.back.push_back(value);
+            state.back_result = state.back_result ? _function(*state.back_result, value) : value;
+        }
+
+        template<typename T>
+        auto remove(FoldState<T>& state, const T&) const noexcept -> void {
+            if(state.front.empty()) {
+                while(!state.back.empty()) {
+                    auto& value = state.back.back();
+                    auto result = state.front.empty() ? value : _function(value, state.front.back().second);
+                    state.front.emplace_back(std::move(value), std::move(result));
+                    state.back.pop_back();
+                }
+                state.back_result = {};
+            }
+            state.front.pop_back();
+        }
+
+        template<typename T>
+        [[nodiscard]] auto get_result(const FoldState<T>& state) const noexcept -> T {
+            if(state.front.empty()) {
+                return *state.back_result;
+            }
+            if(!state.back_result) {
+                return state.front.back().second;
+            }
+            return _function(state.front.back().second, *state.back_result);
+        }
+    };
+
+    constexpr auto collect = Collect {};
+    constexpr auto sum = Sum {};
+    constexpr auto count = Count {};
+    constexpr auto mean = Mean {};
+    constexpr auto min = Extremum<false> {};
+    constexpr auto max = Extremum<true> {};
+
+    // Folds the elements of a window with the given associative function, like reducers::add
+    template<typename F>
+    [[nodiscard]] constexpr auto fold(F function) noexcept -> Fold<F> {
+        return Fold<F> {std::move(function)};
+    }
+
+    template<typename KM, typename VM>
+    [[nodiscard]] constexpr auto group_sum(KM key_mapper, VM value_mapper) noexcept -> GroupSum<KM, VM> {
+        return {std::move(key_mapper), std::move(value_mapper)};
+    }
+}// namespace kstd::streams::aggregators
\ No newline at end of file
@@ -0,0 +1,288 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "abi.hpp"
+#include "extent.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+#include "status.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    namespace detail {
+        template<typename T>
+        struct ErasedPipe {
+            KSTD_NO_MOVE_COPY(ErasedPipe, ErasedPipe)
+
+            ErasedPipe() noexcept = default;
+            virtual ~ErasedPipe() noexcept = default;
+
+            // Constructs up to capacity elements into the given uninitialized storage and returns how many
+            virtual auto fill(T* storage, usize capacity) noexcept -> usize = 0;
+            // Move constructs the erased pipe into the given inline storage
+            virtual auto move_to(void* storage) noexcept -> ErasedPipe* = 0;
+            [[nodiscard]] virtual auto get_size_hint() const noexcept -> usize = 0;
+            [[nodiscard]] virtual auto get_status() const noexcept -> StreamStatus = 0;
+            virtual auto collect_profile(profiling::StreamProfile& profile) const -> void = 0;
+            virtual auto describe(StreamPlan& plan) const -> void = 0;
+        };
+
+        template<typename T, typename PIPE>
+        struct ErasedPipeModel final : public ErasedPipe<T> {
+            private:
+            PIPE _pipe;
+
+            public:
+            explicit ErasedPipeModel(PIPE pipe) noexcept :
+                    _pipe {std::move(pipe)} {
+            }
+
+            ~ErasedPipeModel() noexcept override = default;
+
+            auto fill(T* storage, usize capacity) noexcept -> usize override {
+                usize count = 0;
+                while(count < capacity) {
+                    auto element = _pipe.get_next();
+                    if(!element) {
+                        break;
+                    }
+                    new(storage + count++) T(*element);
+                }
+                return count;
+            }
+
+            auto move_to(void* storage) noexcept -> ErasedPipe<T>* override {
+                return new(storage) ErasedPipeModel(std::move(_pipe));
+            }
+
+            [[nodiscard]] auto get_size_hint() const noexcept -> usize override {
+                return _pipe.get_size_hint();
+            }
+
+            [[nodiscard]] auto get_status() const noexcept -> StreamStatus override {
+                return get_upstream_status(_pipe);
+            }
+
+            auto collect_profile(profiling::StreamProfile& profile) const -> void override {
+                _pipe.collect_profile(profile);
+            }
+
+            auto describe(StreamPlan& plan) const -> void override {
+                _pipe.describe(plan);
+            }
+        };
+    }// namespace detail
+
+    /**
+     * A pipe which hides the type of its upstream pipe behind a single virtual call per batch
+     * of elements, so streams can cross API boundaries and be stored in containers, see AnyStream.
+     * Elements are yielded by value, to erase a stream of references, map it to pointers first.
+     * Upstream pipes which fit into inline_size bytes are stored without a heap allocation.
+     * Each batch pulls up to batch_size elements ahead, so upstream side effects like those of
+     * peek also happen for elements a short-circuiting terminal like find_first never sees.
+     */
+    template<typename T>
+    struct AnyPipe final {
+        static_assert(!std::is_reference_v<T>, "AnyPipe yields values, erase a stream of pointers instead");
+
+        // clang-format off
+        using ElementType   = T;
+        using Self          = AnyPipe<ElementType>;
+        using ValueType     = ElementType;
+        using ErasedType    = detail::ErasedPipe<ElementType>;
+        // clang-format on
+
+        static constexpr usize extent = dynamic_extent;
+        static constexpr usize inline_size = 64;
+        static constexpr usize max_batch_bytes = 512;
+        static constexpr usize max_batch_size = 64;
+        static constexpr usize batch_size = sizeof(ElementType) >= max_batch_bytes ? 1
+                                            : max_batch_bytes / sizeof(ElementType) > max_batch_size
+                                                    ? max_batch_size
+                                                    : max_batch_bytes / sizeof(ElementType);
+
+        private:
+        alignas(std::max_align_t) std::byte _storage[inline_size];// NOLINT
+        ErasedType* _pipe;
+        bool _is_inline;
+        alignas(ElementType) std::byte _batch[sizeof(ElementType) * batch_size];// NOLINT
+        usize _index;
+        usize _count;
+        [[no_unique_address]] profiling::StageProbe<"any"> _probe;
+
+        [[nodiscard]] auto get_batch() noexcept -> ElementType* {
+            return std::launder(reinterpret_cast<ElementType*>(_batch));// NOLINT
+        }
+
+        auto destroy_batch() noexcept -> void {
+            for(auto index = _index; index < _count; ++index) {
+                get_batch()[index].~ElementType();
+            }
+            _index = _count = 0;
+        }
+
+        auto destroy() noexcept -> void {
+            destroy_batch();
+            if(_pipe == nullptr) {
+                return;
+            }
+            if(_is_inline) {
+                _pipe->~ErasedType();
+            }
+            else {
+                delete _pipe;
+            }
+            _pipe = nullptr;
+        }
+
+        auto take(AnyPipe&& other) noexcept -> void {
+            _is_inline = other._is_inline;
+            _pipe = _is_inline && other._pipe != nullptr ? other._pipe->move_to(_storage) : other._pipe;
+            if(_is_inline && other._pipe != nullptr) {
+                other._pipe->~ErasedType();
+            }
+            other._pipe = nullptr;
+            for(auto index = other._index; index < other._count; ++index) {
+                new(get_batch() + _count++) ElementType(std::move(other.get_batch()[index]));
+            }
+            other.destroy_batch();
+        }
+
+        [[nodiscard]] auto read_next() noexcept -> Option<ValueType> {
+            if(_index == _count) {
+                _index = 0;
+                _count = _pipe == nullptr ? 0 : _pipe->fill(get_batch(), batch_size);
+                if(_count == 0) {
+                    return {};
+                }
+            }
+            auto* element = get_batch() + _index++;
+            Option<ValueType> result {std::move(*element)};
+            element->~ElementType();
+            return result;
+        }
+
+        public:
+        AnyPipe() noexcept :
+                _storage {},
+                _pipe {nullptr},
+                _is_inline {false},
+                _batch {},
+                _index {0},
+                _count {0},
+                _probe {} {
+        }
+
+        template<typename PIPE, typename = std::enable_if_t<!std::is_same_v<std::decay_t<PIPE>, Self>>>
+        explicit AnyPipe(PIPE pipe) noexcept :
+                _storage {},
+                _pipe {nullptr},
+                _is_inline {false},
+                _batch {},
+                _index {0},
+                _count {0},
+                _probe {} {
+            using Model = detail::ErasedPipeModel<ElementType, PIPE>;
+            if constexpr(sizeof(Model) <= inline_size && alignof(Model) <= alignof(std::max_align_t) &&
+                         std::is_nothrow_move_constructible_v<PIPE>) {
+                _pipe = new(_storage) Model(std::move(pipe));
+                _is_inline = true;
+            }
+            else {
+                _pipe = new Model(std::move(pipe));
+            }
+        }
+
+        AnyPipe(AnyPipe&& other) noexcept :
+                _storage {},
+                _pipe {nullptr},
+                _is_inline {false},
+                _batch {},
+                _index {0},
+                _count {0},
+                _probe {other._probe} {
+            take(std::move(other));
+        }
+
+        AnyPipe(const AnyPipe&) = delete;
+
+        ~AnyPipe() noexcept {
+            destroy();
+        }
+
+        auto operator=(AnyPipe&& other) noexcept -> AnyPipe& {
+            if(this != &other) {
+                destroy();
+                take(std::move(other));
+                _probe = other._probe;
+            }
+            return *this;
+        }
+
+        auto operator=(const AnyPipe&) -> AnyPipe& = delete;
+
+        [[nodiscard]] auto is_inline() const noexcept -> bool {
+            return _is_inline;
+        }
+
+        [[nodiscard]] auto get_size_hint() const noexcept -> usize {
+            // An unknown upstream size stays unknown, the buffered elements alone are no upper bound
+            const auto upstream = _pipe == nullptr ? 0 : _pipe->get_size_hint();
+            return upstream == 0 ? 0 : upstream + _count - _index;
+        }
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        [[nodiscard]] auto get_status() const noexcept -> StreamStatus {
+            return _pipe == nullptr ? StreamStatus {} : _pipe->get_status();
+        }
+
+        auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            if(_pipe != nullptr) {
+                _pipe->collect_profile(profile);
+            }
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            if(_pipe != nullptr) {
+                _pipe->describe(plan);
+            }
+            auto details = "type erased, batches of " + std::to_string(batch_size) + " elements, ";
+            details += _is_inline ? "stored inline" : "stored on the heap";
+            plan.add_stage(_probe.get_name(), std::move(details));
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
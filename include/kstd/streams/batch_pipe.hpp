@@ -0,0 +1,400 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "abi.hpp"
+#include "core.hpp"
+#include "extent.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+#include "status.hpp"
+#include "timed_supplier_pipe.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    namespace detail {
+        static constexpr usize max_pooled_batches = 8;
+        // Batches reserve at most this many elements and grow from there, so a huge maximum size costs nothing
+        // up front. Larger vectors are not pooled either, they would pin their memory for the stage's lifetime.
+        static constexpr usize max_reserved_batch_size = 1024;
+
+        /*
+         * Recycles the vectors of batches which have been released, so a steady
+         * flow of batches does not allocate. Shared by a BatchPipe and all batches
+         * it handed out, which may be released on other threads.
+         */
+        template<typename T>
+        struct BatchPool final {
+            private:
+            std::vector<std::vector<T>> _vectors;
+            std::atomic<usize> _references;
+            std::atomic_flag _lock;
+
+            auto lock() noexcept -> void {
+                while(_lock.test_and_set(std::memory_order_acquire)) {
+                    _lock.wait(true, std::memory_order_relaxed);
+                }
+            }
+
+            auto unlock() noexcept -> void {
+                _lock.clear(std::memory_order_release);
+                _lock.notify_one();
+            }
+
+            public:
+            KSTD_NO_MOVE_COPY(BatchPool, BatchPool)
+
+            BatchPool() noexcept :
+                    _vectors {},
+                    _references {1},
+                    _lock {} {
+            }
+
+            ~BatchPool() noexcept = default;
+
+            auto acquire_reference() noexcept -> BatchPool* {
+                _references.fetch_add(1, std::memory_order_relaxed);
+                return this;
+            }
+
+            auto release_reference() noexcept -> void {
+                if(_references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    delete this;
+                }
+            }
+
+            [[nodiscard]] auto acquire(usize capacity) -> std::vector<T> {
+                std::vector<T> vector {};
+                lock();
+                if(!_vectors.empty()) {
+                    vector = std::move(_vectors.back());
+                    _vectors.pop_back();
+                }
+                unlock();
+                vector.reserve(capacity);
+                return vector;
+            }
+
+            auto release(std::vector<T> vector) -> void {
+                vector.clear();
+                lock();
+                if(vector.capacity() <= max_reserved_batch_size && _vectors.size() < max_pooled_batches) {
+                    _vectors.push_back(std::move(vector));
+                }
+                unlock();
+            }
+        };
+    }// namespace detail
+
+    /**
+     * A group of elements produced by the batch stage. Its storage goes back to the
+     * stage once the batch is destroyed, unless it has been taken out with release.
+     */
+    template<typename T>
+    struct Batch final {
+        // clang-format off
+        using ElementType   = T;
+        using Self          = Batch<ElementType>;
+        using PoolType      = detail::BatchPool<ElementType>;
+        // clang-format on
+
+        private:
+        std::vector<ElementType> _elements;
+        PoolType* _pool;
+
+        public:
+        Batch(std::vector<ElementType> elements, PoolType* pool) noexcept :
+                _elements {std::move(elements)},
+                _pool {pool->acquire_reference()} {
+        }
+
+        Batch(const Batch&) = delete;
+        auto operator=(const Batch&) -> Batch& = delete;
+
+        Batch(Batch&& other) noexcept :
+                _elements {std::move(other._elements)},
+                _pool {std::exchange(other._pool, nullptr)} {
+        }
+
+        auto operator=(Batch&& other) noexcept -> Batch& {
+            if(this != &other) {
+                if(_pool != nullptr) {
+                    _pool->release(std::move(_elements));
+                    _pool->release_reference();
+                }
+                _elements = std::move(other._elements);
+                _pool = std::exchange(other._pool, nullptr);
+            }
+            return *this;
+        }
+
+        ~Batch() noexcept {
+            if(_pool != nullptr) {
+                _pool->release(std::move(_elements));
+                _pool->release_reference();
+                _pool = nullptr;
+            }
+        }
+
+        // Takes the elements out of the batch, their storage is not recycled then
+        [[nodiscard]] auto release() noexcept -> std::vector<ElementType> {
+            return std::move(_elements);
+        }
+
+        [[nodiscard]] auto get_elements() noexcept -> std::vector<ElementType>& {
+            return _elements;
+        }
+
+        [[nodiscard]] auto get_elements() const noexcept -> const std::vector<ElementType>& {
+            return _elements;
+        }
+
+        [[nodiscard]] auto get_size() const noexcept -> usize {
+            return _elements.size();
+        }
+
+        [[nodiscard]] auto begin() noexcept -> decltype(auto) {
+            return _elements.begin();
+        }
+
+        [[nodiscard]] auto end() noexcept -> decltype(auto) {
+            return _elements.end();
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> decltype(auto) {
+            return _elements.cbegin();
+        }
+
+        [[nodiscard]] auto end() const noexcept -> decltype(auto) {
+            return _elements.cend();
+        }
+
+        [[nodiscard]] auto operator[](usize index) noexcept -> ElementType& {
+            return _elements[index];
+        }
+
+        [[nodiscard]] auto operator[](usize index) const noexcept -> const ElementType& {
+            return _elements[index];
+        }
+    };
+
+    /**
+     * Groups the elements of its upstream pipe into batches of up to max_size elements.
+     * A batch is also cut short once max_latency has passed since its first element was
+     * pulled. A TimedSupplierPipe upstream is only waited on until then, so the batch is
+     * flushed on time even while no elements arrive. Any other upstream pipe is only checked
+     * whenever it yields an element, so a supplier which blocks delays the batch until it
+     * returns. An element arriving after the deadline starts the next batch.
+     */
+    template<typename PIPE>
+    struct BatchPipe final {
+        // clang-format off
+        using PipeType      = PIPE;
+        using Self          = BatchPipe<PipeType>;
+        using ElementType   = std::remove_cv_t<std::remove_reference_t<typename PipeType::ValueType>>;
+        using ValueType     = Batch<ElementType>;
+        using PoolType      = detail::BatchPool<ElementType>;
+        using Clock         = std::chrono::steady_clock;
+        // clang-format on
+
+        static constexpr usize extent = dynamic_extent;
+        static constexpr bool is_timed = detail::TimedPipe<PipeType>;
+
+        private:
+        PipeType _pipe;
+        PoolType* _pool;
+        usize _max_size;
+        Clock::duration _max_latency;
+        Option<ElementType> _late_element;
+        Clock::time_point _late_deadline;
+        bool _is_done;
+        [[no_unique_address]] profiling::StageProbe<"batch"> _probe;
+
+        [[nodiscard]] auto pull_next(Clock::time_point deadline) noexcept -> Option<typename PipeType::ValueType> {
+            if constexpr(is_timed) {
+                if(deadline != Clock::time_point::max()) {
+                    return _pipe.get_next_until(deadline);
+                }
+            }
+            return _pipe.get_next();
+        }
+
+        // Elements yielded by value are moved into the batch, references into the source are copied
+        [[nodiscard]] static auto take(Option<typename PipeType::ValueType>& element) noexcept -> ElementType {
+            if constexpr(std::is_reference_v<typename PipeType::ValueType>) {
+                return *element;
+            }
+            else {
+                return std::move(*element);
+            }
+        }
+
+        [[nodiscard]] auto read_next() noexcept -> Option<ValueType> {
+            if(_is_done) {
+                return {};
+            }
+            auto elements = _pool->acquire(std::min(_max_size, detail::max_reserved_batch_size));
+            const auto has_latency = _max_latency != Clock::duration::max();
+            auto deadline = Clock::time_point::max();
+            if(_late_element) {
+                elements.push_back(std::move(*_late_element));
+                _late_element = {};
+                deadline = _late_deadline;
+            }
+            while(elements.size() < _max_size) {
+                auto element = pull_next(elements.empty() ? Clock::time_point::max() : deadline);
+                if(!element) {
+                    // A timed upstream gives up once the deadline has passed, which only flushes the batch
+                    if(is_timed && !elements.empty() && Clock::now() >= deadline) {
+                        break;
+                    }
+                    _is_done = true;
+                    break;
+                }
+                if(has_latency) {
+                    const auto now = Clock::now();
+                    if(elements.empty()) {
+                        deadline = now + _max_latency;
+                    }
+                    else if(now >= deadline) {
+                        // Flush the batch which is due right away, the late element starts the next one
+                        _late_element = take(element);
+                        _late_deadline = now + _max_latency;
+                        break;
+                    }
+                }
+                elements.push_back(take(element));
+            }
+            if(elements.empty()) {
+                _pool->release(std::move(elements));
+                return {};
+            }
+            return ValueType {std::move(elements), _pool};
+        }
+
+        public:
+        // Latencies beyond what Clock::duration can hold, like hours::max(), mean there is no latency limit
+        template<typename REP, typename PERIOD>
+        [[nodiscard]] static constexpr auto to_max_latency(std::chrono::duration<REP, PERIOD> max_latency) noexcept
+                -> Clock::duration {
+            using Duration = std::chrono::duration<REP, PERIOD>;
+            if(max_latency >= std::chrono::duration_cast<Duration>(Clock::duration::max())) {
+                return Clock::duration::max();
+            }
+            return std::chrono::duration_cast<Clock::duration>(max_latency);
+        }
+
+        BatchPipe(PipeType pipe, usize max_size, Clock::duration max_latency) noexcept :
+                _pipe {std::move(pipe)},
+                _pool {new PoolType {}},
+                _max_size {max_size == 0 ? 1 : max_size},
+                _max_latency {max_latency},
+                _late_element {},
+                _late_deadline {},
+                _is_done {false},
+                _probe {} {
+        }
+
+        BatchPipe(const BatchPipe& other) noexcept :
+                _pipe {other._pipe},
+                _pool {other._pool->acquire_reference()},
+                _max_size {other._max_size},
+                _max_latency {other._max_latency},
+                _late_element {other._late_element},
+                _late_deadline {other._late_deadline},
+                _is_done {other._is_done},
+                _probe {other._probe} {
+        }
+
+        BatchPipe(BatchPipe&& other) noexcept :
+                _pipe {std::move(other._pipe)},
+                _pool {std::exchange(other._pool, nullptr)},
+                _max_size {other._max_size},
+                _max_latency {other._max_latency},
+                _late_element {std::move(other._late_element)},
+                _late_deadline {other._late_deadline},
+                _is_done {other._is_done},
+                _probe {std::move(other._probe)} {
+        }
+
+        auto operator=(BatchPipe other) noexcept -> BatchPipe& {
+            std::swap(_pipe, other._pipe);
+            std::swap(_pool, other._pool);
+            std::swap(_max_size, other._max_size);
+            std::swap(_max_latency, other._max_latency);
+            std::swap(_late_element, other._late_element);
+            std::swap(_late_deadline, other._late_deadline);
+            std::swap(_is_done, other._is_done);
+            std::swap(_probe, other._probe);
+            return *this;
+        }
+
+        ~BatchPipe() noexcept {
+            if(_pool != nullptr) {
+                _pool->release_reference();
+            }
+        }
+
+        [[nodiscard]] auto get_size_hint() const noexcept -> usize {
+            // Batches may be cut short by the latency limit, so their number is unknown
+            return 0;
+        }
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        [[nodiscard]] auto get_status() const noexcept -> StreamStatus
+            requires(detail::StatusPipe<PipeType>)
+        {
+            return _pipe.get_status();
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _pipe.collect_profile(profile);
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            _pipe.describe(plan);
+            std::string details = "batches of up to " + std::to_string(_max_size) + " elements";
+            if(_max_latency != Clock::duration::max()) {
+                const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(_max_latency);
+                details += " or " + std::to_string(latency.count()) + "us";
+            }
+            details += " in pooled std::vectors, " + detail::describe_extent(extent);
+            plan.add_stage(_probe.get_name(), std::move(details));
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
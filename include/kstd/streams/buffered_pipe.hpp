@@ -19,58 +19,150 @@
 
 #pragma once
 
-#include <functional>
+#include <array>
 #include <kstd/defaults.hpp>
 #include <kstd/option.hpp>
+#include <kstd/types.hpp>
 #include <type_traits>
 #include <vector>
 
+#include "abi.hpp"
+#include "extent.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+#include "status.hpp"
 #include "iterator_pipe.hpp"
 
-namespace kstd::streams {
-    template<typename PIPE, typename CALLBACK>
+#ifdef KSTD_STREAMS_PROFILING
+#include "trace.hpp"
+#endif
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    template<typename PIPE, typename CALLBACK, usize EXTENT = dynamic_extent, profiling::StageName NAME = "buffer">
     struct BufferedPipe final {
         // clang-format off
         using PipeType          = PIPE;
         using CallbackType      = CALLBACK;
-        using Self              = BufferedPipe<PipeType, CallbackType>;
-        using BufferType        = std::vector<
-                                    std::remove_cv_t<std::remove_reference_t<typename PipeType::ValueType>>>;
+        using Self              = BufferedPipe<PipeType, CallbackType, EXTENT, NAME>;
+        using ElementType       = std::remove_cv_t<std::remove_reference_t<typename PipeType::ValueType>>;
+        using BufferType        = std::conditional_t<
+                                    EXTENT != dynamic_extent && std::is_default_constructible_v<ElementType> &&
+                                    EXTENT <= max_inline_buffer_size / sizeof(ElementType),
+                                    std::array<ElementType, EXTENT == dynamic_extent ? 0 : EXTENT>,
+                                    std::vector<ElementType>>;
         using DelegateIterator  = typename BufferType::iterator;
         using DelegatePipeType  = IteratorPipe<DelegateIterator>;
         using ValueType         = typename DelegatePipeType::ValueType;
         // clang-format on
 
-        static_assert(std::is_convertible_v<CallbackType, std::function<void(BufferType&)>>,
-                      "Callback signature does not match");
+        static constexpr usize extent = EXTENT;
+
+        static_assert(std::is_invocable_v<CallbackType&, BufferType&>, "Callback signature does not match");
+
+        // Callbacks which can be cancelled return whether they completed
+        static constexpr bool is_cancellable = std::is_same_v<std::invoke_result_t<CallbackType&, BufferType&>, bool>;
+        static constexpr bool has_status = is_cancellable || detail::StatusPipe<PipeType>;
 
         private:
+        struct NoStatus final {};
+
         BufferType _buffer;
-        DelegatePipeType _pipe;
+        usize _index;
+        [[no_unique_address]] std::conditional_t<has_status, StreamStatus, NoStatus> _status;
+        [[no_unique_address]] profiling::StageProbe<NAME> _probe;
+
+        [[nodiscard]] constexpr auto read_next() noexcept -> Option<ValueType> {
+            if(_index == _buffer.size()) {
+                return {};
+            }
+            return _buffer[_index++];
+        }
 
         public:
         KSTD_DEFAULT_MOVE_COPY(BufferedPipe, Self, constexpr)
 
         constexpr BufferedPipe() noexcept :
                 _buffer {},
-                _pipe {} {
+                _index {0},
+                _status {},
+                _probe {} {
         }
 
         constexpr BufferedPipe(PipeType pipe, CallbackType callback) noexcept :
-                _buffer {} {
+                _buffer {},
+                _index {0},
+                _status {},
+                _probe {} {
+#ifdef KSTD_STREAMS_PROFILING
+            const profiling::TraceSpan span {NAME.value, "buffer"};
+#endif
+            const auto scope = _probe.enter();
+            if constexpr(std::is_same_v<BufferType, std::vector<ElementType>>) {
+                // Size hints are exact or 0, stages which drop elements like filters don't forward them
+                _buffer.reserve(pipe.get_size_hint());
+            }
             auto element = pipe.get_next();
-            while(element) {
-                _buffer.push_back(*element);
-                element = pipe.get_next();
+            if constexpr(std::is_same_v<BufferType, std::vector<ElementType>>) {
+                while(element) {
+                    _buffer.push_back(*element);
+                    element = pipe.get_next();
+                }
+            }
+            else {
+                // The upstream pipe yields exactly EXTENT elements, so a fixed buffer avoids the heap entirely
+                for(auto& slot : _buffer) {
+                    slot = *element;
+                    element = pipe.get_next();
+                }
+            }
+            if constexpr(is_cancellable) {
+                _status = detail::get_upstream_status(pipe).merge({!callback(_buffer), false});
             }
-            callback(_buffer);
-            _pipe = DelegatePipeType {_buffer.begin(), _buffer.end()};
+            else {
+                callback(_buffer);
+                if constexpr(has_status) {
+                    _status = pipe.get_status();
+                }
+            }
+            _probe.leave(scope, false);
+            _probe.capture_upstream(pipe);
         }
 
         ~BufferedPipe() noexcept = default;
 
+        [[nodiscard]] constexpr auto get_size_hint() const noexcept -> usize {
+            return _buffer.size() - _index;
+        }
+
         [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
-            return _pipe.get_next();
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        // The upstream pipe is gone by now, so its status was captured on construction
+        [[nodiscard]] constexpr auto get_status() const noexcept -> StreamStatus
+            requires(has_status)
+        {
+            return _status;
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            std::string details = "buffered " + std::to_string(_buffer.size()) + " elements";
+            if constexpr(std::is_same_v<BufferType, std::vector<ElementType>>) {
+                details += " in std::vector, " + std::to_string(_buffer.capacity() * sizeof(ElementType)) +
+                           " bytes on the heap";
+            }
+            else {
+                details += " in std::array, " + std::to_string(sizeof(BufferType)) + " bytes inline";
+            }
+            details += ", upstream consumed on construction, " + detail::describe_extent(extent);
+            plan.add_stage(_probe.get_name(), std::move(details));
         }
     };
 
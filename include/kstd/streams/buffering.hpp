@@ -0,0 +1,124 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <unordered_set>
+
+#include "abi.hpp"
+#include "core.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI::detail {
+    template<typename BUFFER>
+    struct BufferAlgorithms final {
+        private:
+        static auto distinct_hashed(BUFFER& buffer) noexcept -> void {
+            using Type = std::decay_t<typename BUFFER::value_type>;
+            const std::unordered_set<Type> elements {buffer.cbegin(), buffer.cend()};
+            buffer = {elements.cbegin(), elements.cend()};
+        }
+
+        // Sorts runs of cancellation_check_interval elements, then merges them, checking the token in between.
+        // The token type is deduced, so only users of cancellation need cancellation.hpp and <stop_token>
+        template<typename ITERATOR, typename F, typename TOKEN>
+        static auto sort_cancellable(ITERATOR begin, ITERATOR end, F& comparator, const TOKEN& token)
+                -> bool {
+            const auto size = static_cast<usize>(end - begin);
+            const auto at = [&](usize index) {
+                return begin + static_cast<std::ptrdiff_t>(std::min(index, size));
+            };
+            for(usize run = 0; run < size; run += cancellation_check_interval) {
+                if(token.is_cancelled()) {
+                    return false;
+                }
+                std::sort(at(run), at(run + cancellation_check_interval), comparator);
+            }
+            for(auto width = cancellation_check_interval; width < size; width *= 2) {
+                for(usize run = 0; run + width < size; run += width * 2) {
+                    if(token.is_cancelled()) {
+                        return false;
+                    }
+                    std::inplace_merge(at(run), at(run + width), at(run + (width * 2)), comparator);
+                }
+            }
+            return true;
+        }
+
+        public:
+        static constexpr auto sort(BUFFER& buffer) noexcept -> void {
+            std::sort(buffer.begin(), buffer.end());
+        }
+
+        template<typename F>
+        static constexpr auto sort(BUFFER& buffer, F comparator) noexcept -> void {
+            std::sort(buffer.begin(), buffer.end(), std::move(comparator));
+        }
+
+        static constexpr auto reverse_sort(BUFFER& buffer) noexcept -> void {
+            std::sort(buffer.rbegin(), buffer.rend());
+        }
+
+        template<typename F>
+        static constexpr auto reverse_sort(BUFFER& buffer, F comparator) noexcept -> void {
+            std::sort(buffer.rbegin(), buffer.rend(), std::move(comparator));
+        }
+
+        // Returns false and clears the buffer if the token was cancelled before the buffer was sorted
+        template<typename F, typename TOKEN>
+        static auto sort(BUFFER& buffer, F comparator, const TOKEN& token) noexcept -> bool {
+            if(!sort_cancellable(buffer.begin(), buffer.end(), comparator, token)) {
+                buffer.clear();
+                return false;
+            }
+            return true;
+        }
+
+        template<typename F, typename TOKEN>
+        static auto reverse_sort(BUFFER& buffer, F comparator, const TOKEN& token) noexcept -> bool {
+            if(!sort_cancellable(buffer.rbegin(), buffer.rend(), comparator, token)) {
+                buffer.clear();
+                return false;
+            }
+            return true;
+        }
+
+        static constexpr auto distinct(BUFFER& buffer) noexcept -> void {
+            if(std::is_constant_evaluated()) {
+                // Hash sets are not usable in constant evaluation, dedupe in place instead
+                auto end = buffer.begin();
+                for(auto current = buffer.begin(); current != buffer.end(); ++current) {
+                    if(std::find(buffer.begin(), end, *current) != end) {
+                        continue;
+                    }
+                    if(current != end) {
+                        *end = std::move(*current);
+                    }
+                    ++end;
+                }
+                buffer.erase(end, buffer.end());
+            }
+            else {
+                distinct_hashed(buffer);
+            }
+        }
+    };
+}// namespace kstd::streams::detail
\ No newline at end of file
@@ -0,0 +1,115 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <string>
+
+#include "abi.hpp"
+#include "cancellation.hpp"
+#include "core.hpp"
+#include "extent.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+#include "status.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    /**
+     * Forwards the elements of its upstream pipe until the given token is cancelled,
+     * then ends the stream. The token is checked every cancellation_check_interval elements.
+     */
+    template<typename PIPE>
+    struct CancellablePipe final {
+        // clang-format off
+        using PipeType  = PIPE;
+        using Self      = CancellablePipe<PipeType>;
+        using ValueType = typename PipeType::ValueType;
+        // clang-format on
+
+        // The stream may end early, so it can never have a static extent
+        static constexpr usize extent = dynamic_extent;
+
+        private:
+        PipeType _pipe;
+        CancellationToken _token;
+        usize _count;
+        bool _is_cancelled;
+        [[no_unique_address]] profiling::StageProbe<"with_cancellation"> _probe;
+
+        [[nodiscard]] auto read_next() noexcept -> Option<ValueType> {
+            if(_is_cancelled) {
+                return {};
+            }
+            if(_count++ % detail::cancellation_check_interval == 0 && _token.is_cancelled()) {
+                _is_cancelled = true;
+                return {};
+            }
+            return _pipe.get_next();
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(CancellablePipe, Self)
+
+        CancellablePipe(PipeType pipe, CancellationToken token) noexcept :
+                _pipe {std::move(pipe)},
+                _token {std::move(token)},
+                _count {0},
+                _is_cancelled {false},
+                _probe {} {
+        }
+
+        ~CancellablePipe() noexcept = default;
+
+        [[nodiscard]] auto get_size_hint() const noexcept -> usize {
+            // The token may be cancelled at any check, so the number of remaining elements is unknown
+            return 0;
+        }
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        [[nodiscard]] auto is_cancelled() const noexcept -> bool {
+            return _is_cancelled;
+        }
+
+        [[nodiscard]] auto get_status() const noexcept -> StreamStatus {
+            return detail::get_upstream_status(_pipe).merge({_is_cancelled, false});
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _pipe.collect_profile(profile);
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            _pipe.describe(plan);
+            plan.add_stage(_probe.get_name(), "checks its token every " +
+                                                      std::to_string(detail::cancellation_check_interval) +
+                                                      " elements, " + detail::describe_extent(extent));
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
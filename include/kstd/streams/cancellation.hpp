@@ -0,0 +1,78 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <chrono>
+#include <stop_token>
+#include <utility>
+
+#include "abi.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    /**
+     * Tells long-running streams when to stop: once the std::stop_source it was created from
+     * requests a stop, or once its deadline has passed. Stages only check it every few
+     * elements or steps of work, so a cancelled stream stops promptly, but not immediately.
+     */
+    struct CancellationToken final {
+        using Clock = std::chrono::steady_clock;
+
+        private:
+        std::stop_token _stop_token;
+        Clock::time_point _deadline;
+
+        public:
+        CancellationToken() noexcept :
+                _stop_token {},
+                _deadline {Clock::time_point::max()} {
+        }
+
+        explicit CancellationToken(std::stop_token stop_token,
+                                   Clock::time_point deadline = Clock::time_point::max()) noexcept :
+                _stop_token {std::move(stop_token)},
+                _deadline {deadline} {
+        }
+
+        [[nodiscard]] static auto deadline(Clock::time_point deadline) noexcept -> CancellationToken {
+            return CancellationToken {std::stop_token {}, deadline};
+        }
+
+        [[nodiscard]] static auto timeout(Clock::duration timeout) noexcept -> CancellationToken {
+            return deadline(Clock::now() + timeout);
+        }
+
+        // The same token, which additionally expires at the given deadline if that comes first
+        [[nodiscard]] auto with_deadline(Clock::time_point deadline) const noexcept -> CancellationToken {
+            return CancellationToken {_stop_token, deadline < _deadline ? deadline : _deadline};
+        }
+
+        [[nodiscard]] auto is_cancelled() const noexcept -> bool {
+            if(_stop_token.stop_requested()) {
+                return true;
+            }
+            return _deadline != Clock::time_point::max() && Clock::now() >= _deadline;
+        }
+
+        [[nodiscard]] auto get_deadline() const noexcept -> Clock::time_point {
+            return _deadline;
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -19,11 +19,26 @@
 
 #pragma once
 
+#include <iterator>
 #include <kstd/defaults.hpp>
 #include <kstd/types.hpp>
 #include <type_traits>
+#include <utility>
+
+#include "abi.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI::collectors {
+    namespace detail {
+        template<typename T, typename = void>
+        struct HasSize : std::false_type {};
+
+        template<typename T>
+        struct HasSize<T, std::void_t<decltype(std::size(std::declval<T&>()))>> : std::true_type {};
+
+        template<typename T>
+        constexpr bool has_size = HasSize<T>::value;
+    }// namespace detail
 
-namespace kstd::streams::collectors {
     constexpr auto insert = [](auto& pipe, auto& result) noexcept -> void {
         auto element = pipe.get_next();
         while(element) {
@@ -58,24 +73,51 @@ namespace kstd::streams::collectors {
     };
 
     constexpr auto subscript_indexed = [](auto& pipe, auto& result) noexcept -> void {
+        using ContainerType = std::remove_reference_t<decltype(result)>;
         auto element = pipe.get_next();
         usize index = 0;
-        while(element) {
-            result[index] = *element;
-            ++index;
-            element = pipe.get_next();
+
+        if constexpr(detail::has_size<ContainerType>) {
+            const auto size = static_cast<usize>(std::size(result));
+            while(element && index < size) {
+                result[index] = *element;
+                ++index;
+                element = pipe.get_next();
+            }
+        }
+        else {
+            while(element) {
+                result[index] = *element;
+                ++index;
+                element = pipe.get_next();
+            }
         }
     };
 
     constexpr auto subscript_indexed_reverse = [](auto& pipe, auto& result) noexcept -> void {
+        using ContainerType = std::remove_reference_t<decltype(result)>;
         auto element = pipe.get_next();
-        usize index = 0;
-        while(element) {
-            result[index] = *element;
-            ++index;
-            element = pipe.get_next();
+
+        if constexpr(detail::has_size<ContainerType>) {
+            // The target is pre-sized, so every element can be placed at its final slot directly
+            auto index = static_cast<usize>(std::size(result));
+            while(element && index > 0) {
+                --index;
+                result[index] = *element;
+                element = pipe.get_next();
+            }
+        }
+        else {
+            usize index = 0;
+            while(element) {
+                result[index] = *element;
+                ++index;
+                element = pipe.get_next();
+            }
+            for(usize front = 0; front < index / 2; ++front) {
+                std::swap(result[front], result[index - 1 - front]);
+            }
         }
-        result = decltype(result) {result.crbegin(), result.crend()};
     };
 
     template<typename D>
@@ -19,7 +19,9 @@
 
 #pragma once
 
-namespace kstd::streams::comparators {
+#include "abi.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI::comparators {
     constexpr auto deref_less_than = [](auto* lhs, auto* rhs) noexcept -> bool {
         return (*lhs) < (*rhs);
     };
@@ -0,0 +1,951 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @author Alexander Hinze
+ * @since 16/07/2023
+ */
+
+#pragma once
+
+#include <array>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/pack.hpp>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "abi.hpp"
+#include "any_pipe.hpp"
+#include "buffered_pipe.hpp"
+#include "extent.hpp"
+#include "iota_pipe.hpp"
+#include "iterator_pipe.hpp"
+#include "linked_struct_pipe.hpp"
+#include "macros.hpp"
+#include "pipe.hpp"
+#include "plan.hpp"
+#include "prefetch_pipe.hpp"
+#include "profiler.hpp"
+#include "soa_pipe.hpp"
+#include "status.hpp"
+#include "supplier_pipe.hpp"
+
+#include "collectors.hpp"
+#include "comparators.hpp"
+#include "filters.hpp"
+#include "mappers.hpp"
+#include "reducers.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    namespace detail {
+        /**
+         * The algorithms behind sort, reverse_sort and distinct. Only declared here so that
+         * <algorithm> and <unordered_set> are not parsed by every user of streams,
+         * include buffering.hpp (or stream.hpp) to use those operations.
+         */
+        template<typename BUFFER>
+        struct BufferAlgorithms;
+
+        /**
+         * The hash tables behind memory-budgeted distinct and group_by, declared here for the
+         * same reason. Include spilling.hpp to use those operations.
+         */
+        template<typename T>
+        struct DistinctTable;
+
+        template<typename T, typename KM, typename VM, typename R>
+        struct GroupTable;
+
+        // The key mapper behind time based tumbling windows, defined in window_pipe.hpp
+        template<typename DURATION>
+        struct PeriodKeyMapper;
+
+        // Matches std::chrono::duration without needing <chrono>
+        template<typename T>
+        concept Duration = requires(const T& duration) {
+            typename T::rep;
+            typename T::period;
+            duration.count();
+        };
+
+        constexpr auto less_than = [](const auto& a, const auto& b) noexcept -> bool {
+            return a < b;
+        };
+
+        template<typename F, typename T>
+        [[nodiscard]] constexpr auto invoke_field(F field, T& value) noexcept -> decltype(auto) {
+            if constexpr(std::is_member_object_pointer_v<F>) {
+                return (value.*field);
+            }
+            else if constexpr(std::is_member_function_pointer_v<F>) {
+                return (value.*field)();
+            }
+            else {
+                return field(value);
+            }
+        }
+    }// namespace detail
+
+    enum class TruncationPolicy : u8 {
+        STOP, // Stop pulling elements as soon as the target is full
+        DRAIN // Keep pulling and discarding elements so every upstream stage still runs to completion
+    };
+
+    template<typename PIPE>
+    struct Stream;
+
+    /**
+     * A pipeline of values of type T whose type is erased. Unlike streams, which are
+     * temporaries, it can be returned from functions and stored in containers, and
+     * is turned back into a stream to run it. The erased pipeline is pulled in batches,
+     * so it may run ahead of the terminal by up to AnyPipe<T>::batch_size elements.
+     */
+    template<typename T>
+    struct AnyStream final {
+        private:
+        AnyPipe<T> _pipe;
+
+        public:
+        AnyStream() noexcept = default;
+
+        explicit AnyStream(AnyPipe<T> pipe) noexcept :
+                _pipe {std::move(pipe)} {
+        }
+
+        AnyStream(AnyStream&&) noexcept = default;
+        AnyStream(const AnyStream&) = delete;
+        ~AnyStream() noexcept = default;
+
+        auto operator=(AnyStream&&) noexcept -> AnyStream& = default;
+        auto operator=(const AnyStream&) -> AnyStream& = delete;
+
+        /**
+         * Continues the erased pipeline as a stream, leaving this one empty.
+         */
+        [[nodiscard]] auto stream() noexcept -> Stream<AnyPipe<T>>;
+    };
+
+    /**
+     * The stages below need <chrono>, <atomic> or <stop_token>, so they are only declared here as well.
+     * Include batch_pipe.hpp, window_pipe.hpp, cancellable_pipe.hpp or resumable_task.hpp to use
+     * the operations returning them.
+     */
+    struct CancellationToken;
+
+    template<typename PIPE>
+    struct CancellablePipe;
+
+    template<typename PIPE>
+    struct BatchPipe;
+
+    template<typename SUPPLIER>
+    struct TimedSupplierPipe;
+
+    template<typename PIPE, typename AGGREGATOR>
+    struct SlidingWindowPipe;
+
+    template<typename PIPE, typename KM, typename AGGREGATOR>
+    struct TumblingWindowPipe;
+
+    template<typename PIPE, typename F>
+    struct ResumableTask;
+
+    struct MemoryBudget;
+
+    template<typename PIPE, typename TABLE, profiling::StageName NAME>
+    struct SpillingPipe;
+
+    template<typename T, typename HASH>
+    struct SpaceSaving;
+
+    template<typename T, typename HASH>
+    struct CountMinSketch;
+
+    template<typename PIPE>
+    struct Stream final {
+        // clang-format off
+        using PipeType          = PIPE;
+        using ValueType         = typename PipeType::ValueType;
+        using NakedValueType    = std::remove_cv_t<std::remove_reference_t<ValueType>>;
+        using Self              = Stream<PipeType>;
+        // clang-format on
+
+        static constexpr usize extent = pipe_extent<PipeType>;
+        static constexpr bool is_unrollable = extent <= max_unrolled_extent;
+
+        private:
+        PipeType _pipe;
+
+        template<typename F, usize... INDICES>
+        constexpr auto for_each_unrolled(F&& function, std::index_sequence<INDICES...>) noexcept -> void {
+            // Every pipe with a static extent yields exactly that many elements, so no emptiness checks are needed
+            ((static_cast<void>(INDICES), function(*_pipe.get_next())), ...);
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto make_filter_sleeve(F predicate) noexcept -> decltype(auto) {
+            return [predicate = std::move(predicate)](PipeType& pipe) noexcept -> Option<ValueType> {
+                auto element = pipe.get_next();
+                while(element && !predicate(*element)) {
+                    element = pipe.get_next();
+                }
+                return element;
+            };
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto make_map_sleeve(F mapper) noexcept -> decltype(auto) {
+            return [mapper = std::move(mapper)](
+                           PipeType& pipe) noexcept -> Option<std::invoke_result_t<F, ValueType&>> {
+                auto element = pipe.get_next();
+                if(!element) {
+                    return {};
+                }
+                return mapper(*element);
+            };
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto make_peek_sleeve(F function) noexcept -> decltype(auto) {
+            return [function = std::move(function)](PipeType& pipe) noexcept -> Option<ValueType> {
+                auto element = pipe.get_next();
+                if(!element) {
+                    return {};
+                }
+                function(*element);
+                return element;
+            };
+        }
+
+        [[nodiscard]] constexpr auto make_sort_callback() noexcept -> decltype(auto) {
+            return [](auto& buffer) noexcept -> void {
+                detail::BufferAlgorithms<std::decay_t<decltype(buffer)>>::sort(buffer);
+            };
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto make_sort_callback(F comparator) noexcept -> decltype(auto) {// NOLINT
+            return [comparator = std::move(comparator)](auto& buffer) noexcept -> void {
+                detail::BufferAlgorithms<std::decay_t<decltype(buffer)>>::sort(buffer, comparator);
+            };
+        }
+
+        template<typename F, typename TOKEN>
+        [[nodiscard]] auto make_sort_callback(F comparator, TOKEN token) noexcept -> decltype(auto) {
+            return [comparator = std::move(comparator), token = std::move(token)](auto& buffer) noexcept -> bool {
+                return detail::BufferAlgorithms<std::decay_t<decltype(buffer)>>::sort(buffer, comparator, token);
+            };
+        }
+
+        [[nodiscard]] constexpr auto make_reverse_sort_callback() noexcept -> decltype(auto) {
+            return [](auto& buffer) noexcept -> void {
+                detail::BufferAlgorithms<std::decay_t<decltype(buffer)>>::reverse_sort(buffer);
+            };
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto make_reverse_sort_callback(F comparator) noexcept -> decltype(auto) {// NOLINT
+            return [comparator = std::move(comparator)](auto& buffer) noexcept -> void {
+                detail::BufferAlgorithms<std::decay_t<decltype(buffer)>>::reverse_sort(buffer, comparator);
+            };
+        }
+
+        template<typename F, typename TOKEN>
+        [[nodiscard]] auto make_reverse_sort_callback(F comparator, TOKEN token) noexcept
+                -> decltype(auto) {
+            return [comparator = std::move(comparator), token = std::move(token)](auto& buffer) noexcept -> bool {
+                using Algorithms = detail::BufferAlgorithms<std::decay_t<decltype(buffer)>>;
+                return Algorithms::reverse_sort(buffer, comparator, token);
+            };
+        }
+
+        [[nodiscard]] constexpr auto make_distinct_callback() noexcept -> decltype(auto) {
+            return [](auto& buffer) noexcept -> void {
+                detail::BufferAlgorithms<std::decay_t<decltype(buffer)>>::distinct(buffer);
+            };
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(Stream, Self, constexpr)// Streams are temporary only
+
+        explicit constexpr Stream(PipeType pipe) noexcept :
+                _pipe {std::move(pipe)} {
+        }
+
+        ~Stream() noexcept = default;
+
+        template<typename F>
+        [[nodiscard]] constexpr auto map(F mapper) noexcept
+                -> Stream<Pipe<PipeType, decltype(make_map_sleeve(std::move(mapper))), extent, "map">> {
+            auto sleeve = make_map_sleeve(std::move(mapper));
+            using Pipe = Pipe<PipeType, decltype(sleeve), extent, "map">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(sleeve)}};
+        }
+
+        [[nodiscard]] constexpr auto deref_all() noexcept -> decltype(auto) {
+            // Random access sources can be peeked into for free, so their pointees are fetched ahead of time
+            if constexpr(std::is_pointer_v<ValueType> && detail::LookaheadPipe<PipeType>) {
+                return prefetch().map(mappers::dereference);
+            }
+            else {
+                return map(mappers::dereference);
+            }
+        }
+
+        /**
+         * Prefetches the pointees of a stream of pointers (or the referents of a stream of references),
+         * and the given fields of them, distance elements ahead of the current one, see PrefetchPipe.
+         */
+        template<auto... FIELDS>
+        [[nodiscard]] constexpr auto prefetch(usize distance = detail::default_prefetch_distance) noexcept
+                -> Stream<PrefetchPipe<PipeType, FIELDS...>> {
+            using Pipe = PrefetchPipe<PipeType, FIELDS...>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), distance}};
+        }
+
+        [[nodiscard]] constexpr auto address_of_all() noexcept -> decltype(auto) {
+            return map(mappers::address_of);
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto filter(F predicate) noexcept
+                -> Stream<Pipe<PipeType, decltype(make_filter_sleeve(std::move(predicate))), dynamic_extent,
+                               "filter", false>> {
+            static_assert(std::is_invocable_r_v<bool, F&, ValueType&>, "Predicate signature does not match");
+            auto sleeve = make_filter_sleeve(std::move(predicate));
+            // A filter drops an unknown number of elements, so it can't forward the upstream size hint
+            using Pipe = Pipe<PipeType, decltype(sleeve), dynamic_extent, "filter", false>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(sleeve)}};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto peek(F function) noexcept
+                -> Stream<Pipe<PipeType, decltype(make_peek_sleeve(std::move(function))), extent, "peek">> {
+            static_assert(std::is_invocable_v<F&, ValueType&>, "Function signature does not match");
+            auto sleeve = make_peek_sleeve(std::move(function));
+            using Pipe = Pipe<PipeType, decltype(sleeve), extent, "peek">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(sleeve)}};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto peek_all(F function) noexcept
+                -> Stream<BufferedPipe<PipeType, F, extent, "peek_all">> {
+            using Pipe = BufferedPipe<PipeType, F, extent, "peek_all">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(function)}};
+        }
+
+        /**
+         * Describes the stages of this stream and the execution paths its terminals take,
+         * without pulling any elements. Buffering stages have already consumed their
+         * upstream when they were created, so only the buffer is described for them.
+         */
+        [[nodiscard]] auto explain() const -> StreamPlan {
+            StreamPlan plan {};
+            _pipe.describe(plan);
+            std::string details {};
+            if constexpr(is_unrollable) {
+                details = "for_each, reduce and collect_array unrolled over " + std::to_string(extent) + " elements";
+            }
+            else {
+                details = "pull loop";
+            }
+            if constexpr(extent != dynamic_extent) {
+                details += ", count() is a constant";
+            }
+            plan.add_stage("terminal", std::move(details));
+            return plan;
+        }
+
+#ifdef KSTD_STREAMS_PROFILING
+        /**
+         * Runs the given terminal on this stream and fills the given profile
+         * with the per-stage element counts, cycles and allocations of the pipeline.
+         */
+        template<typename F>
+        auto profile(F&& terminal, profiling::StreamProfile& profile) -> std::invoke_result_t<F, Self&> {
+            profiling::StageProbe<"terminal"> probe {};
+            const auto finish = [&](const profiling::ProbeScope& scope) -> void {
+                probe.leave(scope, true);
+                _pipe.collect_profile(profile);
+                probe.collect_profile(profile);
+                profile.finalize();
+            };
+
+            const auto scope = probe.enter();
+            if constexpr(std::is_void_v<std::invoke_result_t<F, Self&>>) {
+                terminal(*this);
+                finish(scope);
+            }
+            else {
+                auto result = terminal(*this);
+                finish(scope);
+                return result;
+            }
+        }
+#endif
+
+        template<typename F>
+        constexpr auto for_each(F&& function) noexcept -> void {
+            if constexpr(is_unrollable) {
+                for_each_unrolled(function, std::make_index_sequence<extent> {});
+                return;
+            }
+            auto element = _pipe.get_next();
+            while(element) {
+                function(*element);
+                element = _pipe.get_next();
+            }
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto reduce(F function, NakedValueType value = NakedValueType {}) noexcept
+                -> NakedValueType {
+            if constexpr(is_unrollable) {
+                for_each_unrolled(
+                        [&](auto& element) noexcept -> void {
+                            value = function(value, element);
+                        },
+                        std::make_index_sequence<extent> {});
+                return value;
+            }
+            auto element = _pipe.get_next();
+            while(element) {
+                value = function(value, *element);
+                element = _pipe.get_next();
+            }
+            return value;
+        }
+
+        [[nodiscard]] constexpr auto distinct() noexcept
+                -> Stream<BufferedPipe<PipeType, decltype(make_distinct_callback()), dynamic_extent, "distinct">> {
+            auto callback = make_distinct_callback();
+            using Pipe = BufferedPipe<PipeType, decltype(callback), dynamic_extent, "distinct">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+        }
+
+        // Like distinct, but spills to temporary files instead of growing past the given budget
+        [[nodiscard]] auto distinct(const MemoryBudget& budget) noexcept
+                -> Stream<SpillingPipe<PipeType, detail::DistinctTable<NakedValueType>, "distinct">> {
+            using Pipe = SpillingPipe<PipeType, detail::DistinctTable<NakedValueType>, "distinct">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), {}, budget}};
+        }
+
+        /**
+         * Yields one pair of key and reduced value per distinct key, spilling to temporary
+         * files instead of growing past the given budget. The mappers may be member pointers.
+         */
+        template<typename KM, typename VM, typename R>
+        [[nodiscard]] auto group_by(KM key_mapper, VM value_mapper, R reducer, const MemoryBudget& budget) noexcept
+                -> Stream<SpillingPipe<PipeType, detail::GroupTable<std::remove_reference_t<ValueType>, KM, VM, R>,
+                                       "group_by">> {
+            using Table = detail::GroupTable<std::remove_reference_t<ValueType>, KM, VM, R>;
+            using Pipe = SpillingPipe<PipeType, Table, "group_by">;
+            Table table {std::move(key_mapper), std::move(value_mapper), std::move(reducer)};
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(table), budget}};
+        }
+
+        template<typename KM, typename VM, typename R, typename BUDGET = MemoryBudget>
+        [[nodiscard]] auto group_by(KM key_mapper, VM value_mapper, R reducer) noexcept -> decltype(auto) {
+            return group_by(std::move(key_mapper), std::move(value_mapper), std::move(reducer), BUDGET {});
+        }
+
+        /**
+         * Groups elements into batches of up to max_size elements, which are also cut short
+         * once max_latency has passed since their first element, see BatchPipe.
+         */
+        template<detail::Duration DURATION>
+        [[nodiscard]] auto batch(usize max_size, DURATION max_latency) noexcept -> Stream<BatchPipe<PipeType>> {
+            using Pipe = BatchPipe<PipeType>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), max_size, Pipe::to_max_latency(max_latency)}};
+        }
+
+        [[nodiscard]] auto batch(usize max_size) noexcept -> Stream<BatchPipe<PipeType>> {
+            return batch(max_size, BatchPipe<PipeType>::Clock::duration::max());
+        }
+
+        // Aggregates over the last window_size elements with one of the aggregators from aggregators.hpp
+        template<typename AGGREGATOR>
+        [[nodiscard]] auto sliding_window_aggregate(usize window_size, AGGREGATOR aggregator) noexcept
+                -> Stream<SlidingWindowPipe<PipeType, AGGREGATOR>> {
+            using Pipe = SlidingWindowPipe<PipeType, AGGREGATOR>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), window_size, std::move(aggregator)}};
+        }
+
+        // Aggregates runs of elements with the same key, the key mapper may be a member pointer
+        template<typename KM, typename AGGREGATOR>
+        [[nodiscard]] auto tumbling_window(KM key_mapper, AGGREGATOR aggregator) noexcept -> decltype(auto) {
+            auto mapper = [key_mapper = std::move(key_mapper)](auto& value) noexcept -> decltype(auto) {
+                return detail::invoke_field(key_mapper, value);
+            };
+            using Pipe = TumblingWindowPipe<PipeType, decltype(mapper), AGGREGATOR>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(mapper), std::move(aggregator)}};
+        }
+
+        // Aggregates the elements arriving within consecutive periods, keyed by the index of the period
+        template<detail::Duration DURATION, typename AGGREGATOR>
+        [[nodiscard]] auto tumbling_window(DURATION length, AGGREGATOR aggregator) noexcept
+                -> Stream<TumblingWindowPipe<PipeType, detail::PeriodKeyMapper<DURATION>, AGGREGATOR>> {
+            using Mapper = detail::PeriodKeyMapper<DURATION>;
+            using Pipe = TumblingWindowPipe<PipeType, Mapper, AGGREGATOR>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), Mapper {length}, std::move(aggregator)}};
+        }
+
+        // Ends the stream once the given token is cancelled, so every following stage and the terminal stop early
+        [[nodiscard]] auto with_cancellation(const CancellationToken& token) noexcept
+                -> Stream<CancellablePipe<PipeType>> {
+            using Pipe = CancellablePipe<PipeType>;
+            return Stream<Pipe> {Pipe {std::move(_pipe), token}};
+        }
+
+        /**
+         * Whether a stage of this stream was cancelled before it yielded everything its
+         * upstream produced, see with_cancellation and sort. Only meaningful once the
+         * stream has been consumed, and a token expiring afterwards does not change it.
+         */
+        [[nodiscard]] constexpr auto was_cancelled() const noexcept -> bool {
+            return detail::get_upstream_status(_pipe).is_cancelled;
+        }
+
+        /**
+         * Whether a stage of this stream lost elements because it could not write or read back
+         * its spill files, see distinct and group_by with a MemoryBudget. Like was_cancelled,
+         * only meaningful once the stream has been consumed.
+         */
+        [[nodiscard]] constexpr auto has_failed() const noexcept -> bool {
+            return detail::get_upstream_status(_pipe).has_failed;
+        }
+
+        [[nodiscard]] constexpr auto distinct_by_address() noexcept -> decltype(auto) {
+            return map(mappers::address_of).distinct().map(mappers::dereference);
+        }
+
+        [[nodiscard]] constexpr auto distinct_by_value() noexcept -> decltype(auto) {
+            return map(mappers::dereference).distinct().map(mappers::address_of);
+        }
+
+        [[nodiscard]] constexpr auto sum() noexcept -> decltype(auto) {
+            return reduce(reducers::add);
+        }
+
+        /**
+         * Streams with a static extent return their extent without pulling
+         * any elements, so peek callbacks upstream are not invoked.
+         */
+        [[nodiscard]] constexpr auto count() noexcept -> usize {
+            if constexpr(extent != dynamic_extent) {
+                return extent;
+            }
+            usize count = 0;
+            auto element = _pipe.get_next();
+            while(element) {
+                ++count;
+                element = _pipe.get_next();
+            }
+            return count;
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto index_of(F predicate) noexcept -> usize {
+            usize index = 0;
+            auto element = _pipe.get_next();
+            while(element && !predicate(*element)) {
+                ++index;
+                element = _pipe.get_next();
+            }
+            return index;
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto index_of_last(F predicate) noexcept -> usize {
+            usize index = 0;
+            usize result = 0;
+            auto element = _pipe.get_next();
+            while(element) {
+                ++index;
+                if(predicate(*element)) {
+                    result = index;
+                }
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto find_first(F predicate) noexcept -> Option<ValueType> {
+            auto element = _pipe.get_next();
+            while(element && !predicate(*element)) {
+                element = _pipe.get_next();
+            }
+            return element;
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto find_last(F predicate) noexcept -> Option<ValueType> {
+            auto element = _pipe.get_next();
+            Option<ValueType> result {};
+            while(element) {
+                if(predicate(*element)) {
+                    result = std::move(element);
+                }
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr auto find_any() noexcept -> Option<ValueType> {
+            return _pipe.get_next();
+        }
+
+        [[nodiscard]] constexpr auto sort() noexcept
+                -> Stream<BufferedPipe<PipeType, decltype(make_sort_callback()), extent, "sort">> {
+            auto callback = make_sort_callback();
+            using Pipe = BufferedPipe<PipeType, decltype(callback), extent, "sort">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto sort(F comparator) noexcept
+                -> Stream<BufferedPipe<PipeType, decltype(make_sort_callback(std::move(comparator))), extent, "sort">> {
+            auto callback = make_sort_callback(std::move(comparator));
+            using Pipe = BufferedPipe<PipeType, decltype(callback), extent, "sort">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+        }
+
+        /**
+         * Sorts in runs and merges them, checking the given token in between. If it is
+         * cancelled, the remaining work is skipped, the resulting stream is empty and
+         * reports was_cancelled().
+         */
+        [[nodiscard]] auto sort(const CancellationToken& token) noexcept -> decltype(auto) {
+            return sort(detail::less_than, token);
+        }
+
+        template<typename F>
+        [[nodiscard]] auto sort(F comparator, const CancellationToken& token) noexcept -> Stream<
+                BufferedPipe<PipeType, decltype(make_sort_callback(std::move(comparator), token)),
+                             dynamic_extent, "sort">> {
+            auto callback = make_sort_callback(std::move(comparator), token);
+            using Pipe = BufferedPipe<PipeType, decltype(callback), dynamic_extent, "sort">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+        }
+
+        [[nodiscard]] constexpr auto reverse_sort() noexcept
+                -> Stream<BufferedPipe<PipeType, decltype(make_reverse_sort_callback()), extent, "reverse_sort">> {
+            auto callback = make_reverse_sort_callback();
+            using Pipe = BufferedPipe<PipeType, decltype(callback), extent, "reverse_sort">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+        }
+
+        template<typename F>
+        [[nodiscard]] constexpr auto reverse_sort(F comparator) noexcept
+                -> Stream<
+                        BufferedPipe<PipeType, decltype(make_reverse_sort_callback(std::move(comparator))), extent,
+                                     "reverse_sort">> {
+            auto callback = make_reverse_sort_callback(std::move(comparator));
+            using Pipe = BufferedPipe<PipeType, decltype(callback), extent, "reverse_sort">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+        }
+
+        [[nodiscard]] auto reverse_sort(const CancellationToken& token) noexcept -> decltype(auto) {
+            return reverse_sort(detail::less_than, token);
+        }
+
+        template<typename F>
+        [[nodiscard]] auto reverse_sort(F comparator, const CancellationToken& token) noexcept -> Stream<
+                BufferedPipe<PipeType, decltype(make_reverse_sort_callback(std::move(comparator), token)),
+                             dynamic_extent, "reverse_sort">> {
+            auto callback = make_reverse_sort_callback(std::move(comparator), token);
+            using Pipe = BufferedPipe<PipeType, decltype(callback), dynamic_extent, "reverse_sort">;
+            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
+        }
+
+        template<template<typename, typename...> typename CONTAINER, typename... PROPS, typename COLLECTOR,
+                 typename... ARGS>
+        [[nodiscard]] constexpr auto collect(COLLECTOR collector, ARGS&&... args) noexcept
+                -> CONTAINER<std::remove_cv_t<std::remove_reference_t<ValueType>>, PROPS...> {
+            CONTAINER<std::remove_cv_t<std::remove_reference_t<ValueType>>, PROPS...> result {
+                    std::forward<ARGS>(args)...};
+            collector(_pipe, result);
+            return result;
+        }
+
+        template<template<typename, typename...> typename CONTAINER, typename... PROPS, typename COLLECTOR>
+        constexpr auto
+        collect_into(CONTAINER<std::remove_cv_t<std::remove_reference_t<ValueType>>, PROPS...>& container,
+                     COLLECTOR collector) noexcept -> void {
+            collector(_pipe, container);
+        }
+
+        template<auto... FIELDS>
+        [[nodiscard]] constexpr auto collect_soa() noexcept -> std::tuple<std::vector<
+                std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<decltype(FIELDS), ValueType&>>>>...> {
+            static_assert(sizeof...(FIELDS) > 0, "At least one field is required");
+            std::tuple<std::vector<
+                    std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<decltype(FIELDS), ValueType&>>>>...>
+                    result {};
+
+            if(const auto size_hint = _pipe.get_size_hint(); size_hint > 0) {
+                std::apply(
+                        [size_hint](auto&... columns) noexcept -> void {
+                            (columns.reserve(size_hint), ...);
+                        },
+                        result);
+            }
+
+            auto element = _pipe.get_next();
+            while(element) {
+                auto& value = *element;
+                std::apply(
+                        [&value](auto&... columns) noexcept -> void {
+                            (columns.push_back(detail::invoke_field(FIELDS, value)), ...);
+                        },
+                        result);
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        template<typename T, usize EXTENT>
+        constexpr auto collect_into_span(std::span<T, EXTENT> span,
+                                         TruncationPolicy policy = TruncationPolicy::STOP) noexcept -> usize {
+            const auto size = span.size();
+            usize index = 0;
+            while(index < size) {
+                auto element = _pipe.get_next();
+                if(!element) {
+                    return index;
+                }
+                span[index] = *element;
+                ++index;
+            }
+            if(policy == TruncationPolicy::DRAIN) {
+                // Not count(), which does not pull anything for streams with a static extent
+                while(_pipe.get_next()) {
+                }
+            }
+            return index;
+        }
+
+        template<usize SIZE = extent>
+        [[nodiscard]] constexpr auto collect_array(TruncationPolicy policy = TruncationPolicy::STOP) noexcept
+                -> std::array<NakedValueType, SIZE> {
+            static_assert(SIZE != dynamic_extent, "Array size must be specified for streams without a static extent");
+            std::array<NakedValueType, SIZE> result {};
+            if constexpr(SIZE == extent && is_unrollable) {
+                usize index = 0;
+                for_each_unrolled(
+                        [&](auto& element) noexcept -> void {
+                            result[index++] = element;
+                        },
+                        std::make_index_sequence<extent> {});
+            }
+            else {
+                collect_into_span(std::span<NakedValueType, SIZE> {result}, policy);
+            }
+            return result;
+        }
+
+        /**
+         * Approximates the k most frequent elements in k counters instead of one per distinct
+         * element, see SpaceSaving in sketches.hpp. The mapper may be a member pointer.
+         */
+        template<typename KM, typename KEY = std::decay_t<decltype(detail::invoke_field(std::declval<KM&>(),
+                                                                                        std::declval<ValueType&>()))>,
+                 typename HASH = std::hash<KEY>>
+        [[nodiscard]] auto top_frequent(usize k, KM key_mapper) noexcept -> SpaceSaving<KEY, HASH> {
+            SpaceSaving<KEY, HASH> result {k};
+            auto element = _pipe.get_next();
+            while(element) {
+                result.add(detail::invoke_field(key_mapper, *element));
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        template<typename HASH = std::hash<NakedValueType>>
+        [[nodiscard]] auto top_frequent(usize k) noexcept -> SpaceSaving<NakedValueType, HASH> {
+            SpaceSaving<NakedValueType, HASH> result {k};
+            auto element = _pipe.get_next();
+            while(element) {
+                result.add(*element);
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        // Counts the frequencies of all elements in width * depth counters, see CountMinSketch in sketches.hpp
+        template<typename KM, typename KEY = std::decay_t<decltype(detail::invoke_field(std::declval<KM&>(),
+                                                                                        std::declval<ValueType&>()))>,
+                 typename HASH = std::hash<KEY>>
+        [[nodiscard]] auto frequency_sketch(usize width, usize depth, KM key_mapper) noexcept
+                -> CountMinSketch<KEY, HASH> {
+            CountMinSketch<KEY, HASH> result {width, depth};
+            auto element = _pipe.get_next();
+            while(element) {
+                result.add(detail::invoke_field(key_mapper, *element));
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        template<typename HASH = std::hash<NakedValueType>>
+        [[nodiscard]] auto frequency_sketch(usize width, usize depth) noexcept -> CountMinSketch<NakedValueType, HASH> {
+            CountMinSketch<NakedValueType, HASH> result {width, depth};
+            auto element = _pipe.get_next();
+            while(element) {
+                result.add(*element);
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        template<template<typename, typename, typename...> typename MAP, typename... PROPS, typename KM, typename VM,
+                 typename... ARGS>
+        [[nodiscard]] constexpr auto collect_map(KM key_mapper, VM value_mapper, ARGS&&... args) noexcept
+                -> MAP<std::invoke_result_t<KM, ValueType&>, std::invoke_result_t<VM, ValueType&>, PROPS...> {
+            MAP<std::invoke_result_t<KM, ValueType&>, std::invoke_result_t<VM, ValueType&>, PROPS...> result {
+                    std::forward<ARGS>(args)...};
+            auto element = _pipe.get_next();
+            while(element) {
+                auto& value = *element;
+                result[key_mapper(value)] = value_mapper(value);
+                element = _pipe.get_next();
+            }
+            return result;
+        }
+
+        template<template<typename, typename, typename...> typename MAP, typename... PROPS, typename KM, typename VM>
+        constexpr auto
+        collect_map_into(MAP<std::invoke_result_t<KM, ValueType&>, std::invoke_result_t<VM, ValueType&>, PROPS...>& map,
+                         KM key_mapper, VM value_mapper) noexcept -> void {
+            auto element = _pipe.get_next();
+            while(element) {
+                auto& value = *element;
+                map[key_mapper(value)] = value_mapper(value);
+                element = _pipe.get_next();
+            }
+        }
+
+        /**
+         * Like for_each, but returns a task which only invokes the function when asked to,
+         * for a number of elements or an amount of time at once, see ResumableTask.
+         */
+        template<typename F>
+        [[nodiscard]] auto resumable(F function) noexcept -> ResumableTask<PipeType, F> {
+            return {std::move(_pipe), std::move(function)};
+        }
+
+        /**
+         * Hides the pipeline type behind an AnyStream, see AnyPipe.
+         */
+        template<typename T = NakedValueType>
+        [[nodiscard]] auto erase() noexcept -> AnyStream<T> {
+            return AnyStream<T> {AnyPipe<T> {std::move(_pipe)}};
+        }
+    };
+
+    template<typename T>
+    auto AnyStream<T>::stream() noexcept -> Stream<AnyPipe<T>> {
+        return Stream<AnyPipe<T>> {std::move(_pipe)};
+    }
+
+    template<typename ITERATOR>
+    [[nodiscard]] constexpr auto stream(ITERATOR begin, ITERATOR end) noexcept -> Stream<IteratorPipe<ITERATOR>> {
+        using Pipe = IteratorPipe<ITERATOR>;
+        return Stream<Pipe> {Pipe {begin, end}};
+    }
+
+    template<typename CONTAINER>
+    [[nodiscard]] constexpr auto stream(CONTAINER& container) noexcept
+            -> Stream<IteratorPipe<typename CONTAINER::iterator, container_extent<CONTAINER>>> {
+        using Pipe = IteratorPipe<typename CONTAINER::iterator, container_extent<CONTAINER>>;
+        return Stream<Pipe> {Pipe {container.begin(), container.end()}};
+    }
+
+    template<typename CONTAINER>
+    [[nodiscard]] constexpr auto stream(const CONTAINER& container) noexcept
+            -> Stream<IteratorPipe<typename CONTAINER::const_iterator, container_extent<CONTAINER>>> {
+        using Pipe = IteratorPipe<typename CONTAINER::const_iterator, container_extent<CONTAINER>>;
+        return Stream<Pipe> {Pipe {container.cbegin(), container.cend()}};
+    }
+
+    template<typename T, usize SIZE>
+    [[nodiscard]] constexpr auto stream(T (&array)[SIZE]) noexcept -> Stream<IteratorPipe<T*, SIZE>> {// NOLINT
+        using Pipe = IteratorPipe<T*, SIZE>;
+        return Stream<Pipe> {Pipe {array, array + SIZE}};
+    }
+
+    template<auto BEGIN, auto END>
+    [[nodiscard]] constexpr auto iota() noexcept -> Stream<IotaPipe<BEGIN, END>> {
+        using Pipe = IotaPipe<BEGIN, END>;
+        return Stream<Pipe> {Pipe {}};
+    }
+
+    template<typename VIEW, typename... CONTAINERS>
+    [[nodiscard]] constexpr auto stream_soa(CONTAINERS&... columns) noexcept
+            -> Stream<SoaPipe<VIEW, decltype(std::begin(columns))...>> {
+        using Pipe = SoaPipe<VIEW, decltype(std::begin(columns))...>;
+        auto size = dynamic_extent;
+        ((size = static_cast<usize>(std::size(columns)) < size ? static_cast<usize>(std::size(columns)) : size), ...);
+        return Stream<Pipe> {Pipe {{std::begin(columns)...}, size}};
+    }
+
+    template<typename... CONTAINERS>
+    [[nodiscard]] constexpr auto stream_soa(CONTAINERS&... columns) noexcept
+            -> Stream<SoaPipe<std::tuple<decltype(*std::begin(columns))...>, decltype(std::begin(columns))...>> {
+        return stream_soa<std::tuple<decltype(*std::begin(columns))...>>(columns...);
+    }
+
+    template<typename SUPPLIER>
+    [[nodiscard]] constexpr auto stream_until_empty(SUPPLIER supplier) noexcept -> Stream<SupplierPipe<SUPPLIER>> {
+        using Pipe = SupplierPipe<SUPPLIER>;
+        return Stream<Pipe> {Pipe {std::move(supplier)}};
+    }
+
+    template<typename SUPPLIER>
+    [[nodiscard]] auto stream_until_empty(SUPPLIER supplier, const CancellationToken& token) noexcept
+            -> Stream<CancellablePipe<SupplierPipe<SUPPLIER>>> {
+        return stream_until_empty(std::move(supplier)).with_cancellation(token);
+    }
+
+    // Like stream_until_empty, but the supplier takes a deadline, see TimedSupplierPipe, batch and tumbling_window
+    template<typename SUPPLIER>
+    [[nodiscard]] auto stream_until_empty_timed(SUPPLIER supplier) noexcept -> Stream<TimedSupplierPipe<SUPPLIER>> {
+        using Pipe = TimedSupplierPipe<SUPPLIER>;
+        return Stream<Pipe> {Pipe {std::move(supplier)}};
+    }
+
+    template<typename A, typename F>
+    [[nodiscard]] constexpr auto stream_until_null(A address, F functor) noexcept -> Stream<LinkedStructPipe<A, F>> {
+        using Pipe = LinkedStructPipe<A, F>;
+        return Stream<Pipe> {Pipe {address, std::move(functor)}};
+    }
+
+    template<typename CONTAINER>
+    [[nodiscard]] constexpr auto reverse_stream(CONTAINER& container) noexcept
+            -> Stream<IteratorPipe<typename CONTAINER::reverse_iterator>> {
+        return stream<typename CONTAINER::reverse_iterator>(container.rbegin(), container.rend());
+    }
+
+    template<typename CONTAINER>
+    [[nodiscard]] constexpr auto reverse_stream(const CONTAINER& container) noexcept
+            -> Stream<IteratorPipe<typename CONTAINER::const_reverse_iterator>> {
+        return stream<typename CONTAINER::const_reverse_iterator>(container.crbegin(), container.crend());
+    }
+}// namespace kstd::streams
\ No newline at end of file
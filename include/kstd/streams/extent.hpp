@@ -0,0 +1,72 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <kstd/types.hpp>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "abi.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    /**
+     * Marks a pipe or container whose number of elements is only known at runtime.
+     * Any other extent is the exact number of elements a pipe yields.
+     */
+    constexpr usize dynamic_extent = std::numeric_limits<usize>::max();
+
+    /**
+     * Pipes with a static extent at or below this limit get their terminals fully unrolled.
+     */
+    constexpr usize max_unrolled_extent = 32;
+
+    /**
+     * Buffering stages keep the elements of a static extent pipe inline up to this many bytes,
+     * larger buffers are put on the heap so they can't overflow the stack.
+     */
+    constexpr usize max_inline_buffer_size = 4096;
+
+    namespace detail {
+        template<typename PIPE, typename = void>
+        struct PipeExtent : std::integral_constant<usize, dynamic_extent> {};
+
+        template<typename PIPE>
+        struct PipeExtent<PIPE, std::void_t<decltype(PIPE::extent)>> : std::integral_constant<usize, PIPE::extent> {};
+
+        template<typename CONTAINER>
+        struct ContainerExtent : std::integral_constant<usize, dynamic_extent> {};
+
+        template<typename T, usize SIZE>
+        struct ContainerExtent<std::array<T, SIZE>> : std::integral_constant<usize, SIZE> {};
+
+        template<typename T, usize SIZE>
+        struct ContainerExtent<std::span<T, SIZE>>
+                : std::integral_constant<usize, SIZE == std::dynamic_extent ? dynamic_extent : SIZE> {};
+    }// namespace detail
+
+    template<typename PIPE>
+    constexpr usize pipe_extent = detail::PipeExtent<PIPE>::value;
+
+    template<typename CONTAINER>
+    constexpr usize container_extent = detail::ContainerExtent<std::remove_cv_t<CONTAINER>>::value;
+}// namespace kstd::streams
\ No newline at end of file
@@ -22,7 +22,9 @@
 #include <kstd/option.hpp>
 #include <type_traits>
 
-namespace kstd::streams::filters {
+#include "abi.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI::filters {
     constexpr auto non_zero = [](auto value) noexcept -> bool {
         using Type = decltype(value);
         static_assert(std::is_integral_v<Type> || std::is_floating_point_v<Type>);
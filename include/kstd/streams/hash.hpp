@@ -0,0 +1,34 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+#pragma once
+
+#include <kstd/types.hpp>
+
+#include "abi.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI::detail {
+    // Scrambles an std::hash value with the splitmix64 finalizer, every seed gives an independent hash function
+    [[nodiscard]] constexpr auto mix_hash(usize hash, u64 seed) noexcept -> usize {
+        u64 value = static_cast<u64>(hash) ^ ((seed + 1) * 0x9E3779B97F4A7C15);
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+        return static_cast<usize>(value ^ (value >> 31));
+    }
+}// namespace kstd::streams::detail
@@ -0,0 +1,87 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+
+#include "abi.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    template<auto BEGIN, auto END>
+    struct IotaPipe final {
+        // clang-format off
+        using ElementType   = std::common_type_t<decltype(BEGIN), decltype(END)>;
+        using Self          = IotaPipe<BEGIN, END>;
+        using ValueType     = ElementType;
+        // clang-format on
+
+        static_assert(std::is_integral_v<ElementType>, "Iota bounds must be integral");
+        static_assert(BEGIN <= END, "Iota range must not be negative");
+
+        static constexpr usize extent = static_cast<usize>(END - BEGIN);
+
+        private:
+        ElementType _next;
+        [[no_unique_address]] profiling::StageProbe<"iota"> _probe;
+
+        [[nodiscard]] constexpr auto read_next() noexcept -> Option<ValueType> {
+            if(_next == END) {
+                return {};
+            }
+            return _next++;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(IotaPipe, Self, constexpr)
+
+        constexpr IotaPipe() noexcept :
+                _next {BEGIN},
+                _probe {} {
+        }
+
+        ~IotaPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_size_hint() const noexcept -> usize {
+            return static_cast<usize>(END - _next);
+        }
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            auto details = "constant range, " + detail::describe_size(get_size_hint()) + ", ";
+            plan.add_stage(_probe.get_name(), std::move(details) + detail::describe_extent(extent) + ", splittable");
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -19,55 +19,125 @@
 
 #pragma once
 
+#include <iterator>
 #include <kstd/defaults.hpp>
 #include <kstd/option.hpp>
+#include <kstd/types.hpp>
 
-namespace kstd::streams {
-    template<typename ITERATOR>
+#include "abi.hpp"
+#include "extent.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    template<typename ITERATOR, usize EXTENT = dynamic_extent>
     struct IteratorPipe final {
         // clang-format off
         using Iterator      = ITERATOR;
-        using Self          = IteratorPipe<Iterator>;
+        using Traits        = std::iterator_traits<Iterator>;
+        using Self          = IteratorPipe<Iterator, EXTENT>;
         using ValueType     = std::conditional_t<
-                                std::is_pointer_v<typename Iterator::value_type>,
-                                typename Iterator::value_type,
+                                std::is_pointer_v<typename Traits::value_type>,
+                                typename Traits::value_type,
                                 std::conditional_t<
-                                    std::is_const_v<std::remove_pointer_t<typename Iterator::pointer>>,
-                                    const std::remove_cv_t<std::remove_reference_t<typename Iterator::value_type>>&,
-                                    std::remove_cv_t<std::remove_reference_t<typename Iterator::value_type>>&>>;
+                                    std::is_const_v<std::remove_pointer_t<typename Traits::pointer>>,
+                                    const std::remove_cv_t<std::remove_reference_t<typename Traits::value_type>>&,
+                                    std::remove_cv_t<std::remove_reference_t<typename Traits::value_type>>&>>;
         // clang-format on
 
+        static constexpr usize extent = EXTENT;
+
         private:
         Iterator _current;
         Iterator _end;
+        [[no_unique_address]] profiling::StageProbe<"iterator"> _probe;
+
+        [[nodiscard]] constexpr auto read_next() noexcept -> Option<ValueType> {
+            if(_current == _end) {
+                return {};
+            }
+            if constexpr(std::is_const_v<std::remove_pointer_t<typename Traits::pointer>>) {
+                ValueType result = *_current;
+                _current = std::next(_current);
+                return result;
+            }
+            else {
+                return *(_current++);
+            }
+        }
 
         public:
         KSTD_DEFAULT_MOVE_COPY(IteratorPipe, Self, constexpr)
 
         constexpr IteratorPipe() noexcept :
                 _current {},
-                _end {} {
+                _end {},
+                _probe {} {
         }
 
         constexpr IteratorPipe(Iterator begin, Iterator end) noexcept :
                 _current {begin},
-                _end {end} {
+                _end {end},
+                _probe {} {
         }
 
         ~IteratorPipe() noexcept = default;
 
-        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
-            if(_current == _end) {
+        [[nodiscard]] constexpr auto get_size_hint() const noexcept -> usize {
+            if constexpr(std::is_base_of_v<std::random_access_iterator_tag, typename Traits::iterator_category>) {
+                return static_cast<usize>(_end - _current);
+            }
+            else {
+                return 0;
+            }
+        }
+
+        // The element distance positions after the next one, without consuming anything
+        [[nodiscard]] constexpr auto peek_ahead(usize distance) const noexcept -> Option<ValueType>
+            requires(std::is_base_of_v<std::random_access_iterator_tag, typename Traits::iterator_category>)
+        {
+            if(distance >= static_cast<usize>(_end - _current)) {
                 return {};
             }
-            if constexpr(std::is_const_v<std::remove_pointer_t<typename Iterator::pointer>>) {
-                ValueType result = *_current;
-                _current = std::next(_current);
-                return result;
+            return *(_current + static_cast<typename Traits::difference_type>(distance));
+        }
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            std::string details {};
+            if constexpr(std::contiguous_iterator<Iterator>) {
+                details = "contiguous iterator";
+            }
+            else if constexpr(std::is_base_of_v<std::random_access_iterator_tag,
+                                                typename Traits::iterator_category>) {
+                details = "random access iterator";
+            }
+            else if constexpr(std::is_base_of_v<std::bidirectional_iterator_tag,
+                                                typename Traits::iterator_category>) {
+                details = "bidirectional iterator";
+            }
+            else if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename Traits::iterator_category>) {
+                details = "forward iterator";
             }
             else {
-                return *(_current++);
+                details = "input iterator";
             }
+            details += ", " + detail::describe_size(get_size_hint()) + ", " + detail::describe_extent(extent);
+            // Only random access sources can be split into chunks without walking them
+            details += std::is_base_of_v<std::random_access_iterator_tag, typename Traits::iterator_category>
+                               ? ", splittable"
+                               : ", not splittable";
+            plan.add_stage(_probe.get_name(), std::move(details));
         }
     };
 
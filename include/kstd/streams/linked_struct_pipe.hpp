@@ -21,9 +21,14 @@
 
 #include <kstd/defaults.hpp>
 #include <kstd/option.hpp>
+#include <kstd/types.hpp>
 #include <type_traits>
 
-namespace kstd::streams {
+#include "abi.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
     template<typename A, typename F>
     struct LinkedStructPipe final {
         using AddressType = A;
@@ -37,29 +42,51 @@ namespace kstd::streams {
         private:
         AddressType _current;
         FunctorType _functor;
+        [[no_unique_address]] profiling::StageProbe<"linked_struct"> _probe;
+
+        [[nodiscard]] constexpr auto read_next() noexcept -> Option<ValueType> {
+            if(_current == nullptr) {
+                return {};
+            }
+            auto* result = _current;
+            _current = _functor(_current);
+            return *result;
+        }
 
         public:
         KSTD_DEFAULT_MOVE_COPY(LinkedStructPipe, Self, constexpr)
 
         constexpr LinkedStructPipe() noexcept :
                 _current {nullptr},
-                _functor {} {
+                _functor {},
+                _probe {} {
         }
 
         constexpr LinkedStructPipe(AddressType address, FunctorType functor) noexcept :
                 _current {address},
-                _functor {std::move(functor)} {
+                _functor {std::move(functor)},
+                _probe {} {
         }
 
         ~LinkedStructPipe() noexcept = default;
 
+        [[nodiscard]] constexpr auto get_size_hint() const noexcept -> usize {
+            return 0;
+        }
+
         [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
-            if(_current == nullptr) {
-                return {};
-            }
-            auto* result = _current;
-            _current = _functor(_current);
-            return *result;
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            plan.add_stage(_probe.get_name(), "pointer chasing, size unknown, dynamic extent, not splittable");
         }
     };
 }// namespace kstd::streams
\ No newline at end of file
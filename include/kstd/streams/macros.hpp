@@ -0,0 +1,56 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#define KSTD_PTR_FIELD_FUNCTOR(n)                                                                                      \
+    [](auto* value) noexcept -> auto {                                                                                 \
+        return value->n;                                                                                               \
+    }
+
+#define KSTD_FIELD_FUNCTOR(n)                                                                                          \
+    [](auto& value) noexcept -> auto {                                                                                 \
+        return value.n;                                                                                                \
+    }
+
+#define KSTD_CONSTANT_FUNCTOR(x)                                                                                       \
+    [](auto& value) noexcept -> auto {                                                                                 \
+        return x;                                                                                                      \
+    }
+
+#define KSTD_RCAST_FIELD_FUNCTOR(n, t)                                                                                 \
+    [](auto& value) noexcept -> auto {                                                                                 \
+        return reinterpret_cast<t>(value.n);                                                                           \
+    }
+
+#define KSTD_SCAST_FIELD_FUNCTOR(n, t)                                                                                 \
+    [](auto& value) noexcept -> auto {                                                                                 \
+        return static_cast<t>(value.n);                                                                                \
+    }
+
+#define KSTD_RCAST_PTR_FIELD_FUNCTOR(n, t)                                                                             \
+    [](auto* value) noexcept -> auto {                                                                                 \
+        return reinterpret_cast<t>(value->n);                                                                          \
+    }
+
+#define KSTD_SCAST_PTR_FIELD_FUNCTOR(n, t)                                                                             \
+    [](auto* value) noexcept -> auto {                                                                                 \
+        return static_cast<t>(value->n);                                                                               \
+    }
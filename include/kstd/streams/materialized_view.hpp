@@ -0,0 +1,110 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <type_traits>
+#include <utility>
+
+#include "abi.hpp"
+#include "aggregators.hpp"
+#include "core.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    /**
+     * The result of a pipeline over a container, evaluated once and then kept up to date
+     * by feeding every insertion, removal and update of the container through the view.
+     * Each change only runs the pipeline over the affected element, so the pipeline has to
+     * work element by element (map, filter, peek and friends, but not sort or distinct).
+     */
+    template<typename ELEMENT, typename PIPELINE, typename AGGREGATOR>
+    struct MaterializedView final {
+        // clang-format off
+        using ElementType    = ELEMENT;
+        using PipelineType   = PIPELINE;
+        using AggregatorType = AGGREGATOR;
+        using Self           = MaterializedView<ElementType, PipelineType, AggregatorType>;
+        using ResultType     = typename decltype(std::declval<PipelineType&>()(stream(
+                std::declval<const ElementType*>(), std::declval<const ElementType*>())))::NakedValueType;
+        using StateType      = decltype(std::declval<const AggregatorType&>().template make_state<ResultType>());
+        // clang-format on
+
+        static_assert(aggregators::RemovesAnyElement<AggregatorType>,
+                      "Aggregator can only remove its oldest element, which only works for windows");
+
+        private:
+        PipelineType _pipeline;
+        AggregatorType _aggregator;
+        StateType _state;
+
+        template<typename F>
+        auto apply(const ElementType& element, F&& function) -> void {
+            _pipeline(stream(&element, &element + 1)).for_each(std::forward<F>(function));
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(MaterializedView, Self)
+
+        template<typename CONTAINER>
+        MaterializedView(const CONTAINER& container, PipelineType pipeline, AggregatorType aggregator) :
+                _pipeline {std::move(pipeline)},
+                _aggregator {std::move(aggregator)},
+                _state {_aggregator.template make_state<ResultType>()} {
+            _pipeline(stream(container)).for_each([this](const auto& result) {
+                _aggregator.add(_state, static_cast<const ResultType&>(result));
+            });
+        }
+
+        ~MaterializedView() noexcept = default;
+
+        auto insert(const ElementType& element) -> void {
+            apply(element, [this](const auto& result) {
+                _aggregator.add(_state, static_cast<const ResultType&>(result));
+            });
+        }
+
+        auto erase(const ElementType& element) -> void {
+            apply(element, [this](const auto& result) {
+                _aggregator.remove(_state, static_cast<const ResultType&>(result));
+            });
+        }
+
+        auto update(const ElementType& old_element, const ElementType& new_element) -> void {
+            erase(old_element);
+            insert(new_element);
+        }
+
+        [[nodiscard]] auto get() const noexcept -> const StateType& {
+            return _state;
+        }
+    };
+
+    /**
+     * Creates a view of the given pipeline over the given container, for example:
+     * materialized_view(values, [](auto stream) { return stream.filter(filters::even); }, aggregators::sum)
+     */
+    template<typename CONTAINER, typename PIPELINE, typename AGGREGATOR = aggregators::Collect>
+    [[nodiscard]] auto materialized_view(const CONTAINER& container, PIPELINE pipeline,
+                                         AGGREGATOR aggregator = {})
+            -> MaterializedView<std::remove_cv_t<typename CONTAINER::value_type>, PIPELINE, AGGREGATOR> {
+        return {container, std::move(pipeline), std::move(aggregator)};
+    }
+}// namespace kstd::streams
\ No newline at end of file
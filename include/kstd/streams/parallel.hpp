@@ -0,0 +1,535 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "abi.hpp"
+#include "cancellation.hpp"
+#include "core.hpp"
+#include "sketches.hpp"
+
+#ifdef KSTD_STREAMS_PROFILING
+#include "trace.hpp"
+#endif
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    struct ParallelOptions final {
+        usize threads = 0;      // Zero starts one worker per hardware thread
+        usize grain_size = 0;   // Elements per chunk, zero picks it from the measured cost per element
+        bool numa_aware = true; // Pin workers to NUMA nodes and hand them chunks of node-local memory first
+        CancellationToken cancellation {};// Checked before every chunk
+    };
+
+    namespace detail {
+        struct NumaNode final {
+            i32 id;
+            std::vector<u32> cpus;
+        };
+
+        // Parses the lists found in /sys/devices/system/node/node*/cpulist, like 0-3,8-11
+        [[nodiscard]] inline auto parse_cpu_list(std::string_view list) -> std::vector<u32> {
+            std::vector<u32> cpus {};
+            while(!list.empty()) {
+                const auto separator = list.find(',');
+                const auto range = list.substr(0, separator);
+                list = separator == std::string_view::npos ? std::string_view {} : list.substr(separator + 1);
+                u32 first = 0;
+                const auto [first_end, first_error] = std::from_chars(range.data(), range.data() + range.size(), first);
+                if(first_error != std::errc {}) {
+                    continue;
+                }
+                u32 last = first;
+                if(first_end != range.data() + range.size() && *first_end == '-') {
+                    std::from_chars(first_end + 1, range.data() + range.size(), last);
+                }
+                for(auto cpu = first; cpu <= last; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            }
+            return cpus;
+        }
+
+        /*
+         * The NUMA nodes of this machine which have CPUs. Without NUMA information
+         * there is a single node without any CPUs, whose workers are never pinned.
+         */
+        [[nodiscard]] inline auto get_numa_nodes() -> const std::vector<NumaNode>& {
+            static const auto nodes = [] {
+                std::vector<NumaNode> nodes {};
+#ifdef __linux__
+                std::error_code error {};
+                for(const auto& entry : std::filesystem::directory_iterator {"/sys/devices/system/node", error}) {
+                    const auto name = entry.path().filename().string();
+                    i32 id = 0;
+                    if(!name.starts_with("node") ||
+                       std::from_chars(name.data() + 4, name.data() + name.size(), id).ec != std::errc {}) {
+                        continue;
+                    }
+                    std::ifstream file {entry.path() / "cpulist"};
+                    std::string list {};
+                    std::getline(file, list);
+                    auto cpus = parse_cpu_list(list);
+                    if(!cpus.empty()) {
+                        nodes.push_back({id, std::move(cpus)});
+                    }
+                }
+                std::sort(nodes.begin(), nodes.end(), [](const auto& a, const auto& b) { return a.id < b.id; });
+#endif
+                if(nodes.empty()) {
+                    nodes.push_back({-1, {}});
+                }
+                return nodes;
+            }();
+            return nodes;
+        }
+
+        // Looks up the NUMA node backing each address, -1 where the page is not resident or the node is unknown
+        [[nodiscard]] inline auto get_memory_nodes(std::vector<const void*> addresses) -> std::vector<i32> {
+            std::vector<i32> nodes(addresses.size(), -1);
+#ifdef __linux__
+            std::vector<int> status(addresses.size(), -1);
+            // Without target nodes, move_pages only reports where each page currently lives
+            if(syscall(SYS_move_pages, 0, addresses.size(), addresses.data(), nullptr, status.data(), 0) == 0) {
+                std::transform(status.cbegin(), status.cend(), nodes.begin(), [](auto node) {
+                    return node < 0 ? -1 : static_cast<i32>(node);
+                });
+            }
+#endif
+            return nodes;
+        }
+
+        inline auto pin_to_cpus(const std::vector<u32>& cpus) noexcept -> void {
+#ifdef __linux__
+            cpu_set_t set {};
+            CPU_ZERO(&set);
+            for(const auto cpu : cpus) {
+                if(cpu < CPU_SETSIZE) {
+                    CPU_SET(cpu, &set);
+                }
+            }
+            sched_setaffinity(0, sizeof(set), &set);
+#endif
+        }
+
+        // How long to sample before picking a grain size, and how much work it takes to start threads
+        // clang-format off
+        static constexpr usize min_sample_size      = 64;
+        static constexpr auto sample_time           = std::chrono::microseconds {20};
+        static constexpr auto min_parallel_time     = std::chrono::microseconds {100};
+        static constexpr auto target_chunk_time     = std::chrono::microseconds {50};
+        static constexpr usize chunks_per_thread    = 8;
+        // clang-format on
+
+        /*
+         * Picks the grain size for the remaining elements from the sampled cost per element.
+         * If they are too cheap to be worth starting threads, num_threads is set to one.
+         */
+        [[nodiscard]] inline auto pick_grain_size(f64 cost_ns, usize remaining, usize& num_threads) noexcept -> usize {
+            using Nanoseconds = std::chrono::duration<f64, std::nano>;
+            const auto cost = std::max(cost_ns, 1.0);
+            const auto grain = static_cast<usize>(Nanoseconds {target_chunk_time}.count() / cost);
+            const auto remaining_time = cost * static_cast<f64>(remaining);
+            if(num_threads <= 1 || remaining_time < Nanoseconds {min_parallel_time}.count()) {
+                // Still chunked, so cancellation is checked in between
+                num_threads = 1;
+                return std::max<usize>(grain, 1);
+            }
+            // Small enough for several chunks per worker, so skewed inputs still balance out
+            const auto max_grain = std::max<usize>(remaining / (num_threads * chunks_per_thread), 1);
+            return std::clamp<usize>(grain, 1, max_grain);
+        }
+
+        struct ChunkQueue final {
+            std::vector<usize> chunks;
+            std::atomic<usize> next {0};
+        };
+
+        // The state one worker updates for every element, on cache lines of its own
+        template<typename T>
+        struct alignas(64) WorkerSlot final {
+            T value;
+        };
+
+        struct NoPipeline final {};
+
+        template<typename PIPELINE, typename ITERATOR>
+        [[nodiscard]] constexpr auto apply_pipeline(PIPELINE& pipeline, ITERATOR begin, ITERATOR end) noexcept
+                -> decltype(auto) {
+            if constexpr(std::is_same_v<PIPELINE, NoPipeline>) {
+                return stream(begin, end);
+            }
+            else {
+                return pipeline(stream(begin, end));
+            }
+        }
+    }// namespace detail
+
+    /**
+     * Runs a pipeline over a random access range on several threads. The range is split
+     * into chunks, each chunk is streamed through the pipeline on its own and the per-chunk
+     * results are combined in order, so reductions need to be associative, but not commutative.
+     * Like for materialized views, the pipeline has to work element by element.
+     *
+     * Unless a grain size is given, the first elements are processed on the calling thread
+     * in growing chunks to measure how expensive the pipeline is per element. Cheap work on
+     * small ranges then never leaves the calling thread, while expensive work is split into
+     * chunks of roughly equal duration, several per worker.
+     *
+     * On machines with several NUMA nodes, every worker is pinned to the CPUs of one node and
+     * first takes the chunks whose memory lives on that node, before helping out other nodes.
+     * Buffers created by the pipeline and the per-chunk results of collect_chunks are
+     * allocated and first written by the worker processing the chunk, so they live on its node.
+     */
+    template<typename ITERATOR, typename PIPELINE>
+    struct ParallelStream final {
+        // clang-format off
+        using IteratorType      = ITERATOR;
+        using PipelineType      = PIPELINE;
+        using Self              = ParallelStream<IteratorType, PipelineType>;
+        using NakedValueType    = typename decltype(detail::apply_pipeline(std::declval<PipelineType&>(),
+                                    std::declval<IteratorType>(), std::declval<IteratorType>()))::NakedValueType;
+        // clang-format on
+
+        static_assert(std::random_access_iterator<IteratorType>, "Parallel streams need a random access range");
+
+        private:
+        IteratorType _begin;
+        IteratorType _end;
+        PipelineType _pipeline;
+        ParallelOptions _options;
+        bool _was_cancelled;
+
+        [[nodiscard]] auto get_thread_count() const noexcept -> usize {
+            if(_options.threads != 0) {
+                return _options.threads;
+            }
+            return std::max<usize>(std::thread::hardware_concurrency(), 1);
+        }
+
+        [[nodiscard]] auto locate_chunks(usize offset, usize num_chunks, usize grain, usize num_nodes) const
+                -> std::vector<i32> {
+            if constexpr(std::contiguous_iterator<IteratorType>) {
+                if(num_nodes > 1) {
+                    std::vector<const void*> addresses(num_chunks);
+                    for(usize chunk = 0; chunk < num_chunks; ++chunk) {
+                        const auto begin = offset + (chunk * grain);
+                        addresses[chunk] = std::to_address(_begin + static_cast<std::ptrdiff_t>(begin));
+                    }
+                    return detail::get_memory_nodes(std::move(addresses));
+                }
+            }
+            return std::vector<i32>(num_chunks, -1);
+        }
+
+        // Terminals which keep state per worker take the index of the worker too, the calling thread is worker 0
+        template<typename F>
+        static auto invoke_process(F& process, IteratorType begin, IteratorType end, usize worker) -> decltype(auto) {
+            if constexpr(std::is_invocable_v<F&, IteratorType, IteratorType, usize>) {
+                return process(begin, end, worker);
+            }
+            else {
+                return process(begin, end);
+            }
+        }
+
+        /*
+         * Processes growing chunks on the calling thread until they took long enough to
+         * estimate the cost per element, then picks a grain size for the remaining elements,
+         * see detail::pick_grain_size.
+         */
+        template<typename R, typename F>
+        [[nodiscard]] auto sample(F& process, std::vector<R>& results, usize& offset, usize size, usize& num_threads)
+                const -> usize {
+#ifdef KSTD_STREAMS_PROFILING
+            const profiling::TraceSpan span {"sample", "parallel"};
+#endif
+            const auto start = std::chrono::steady_clock::now();
+            auto elapsed = std::chrono::steady_clock::duration::zero();
+            auto sample_size = detail::min_sample_size;
+            while(offset < size && elapsed < detail::sample_time && !_options.cancellation.is_cancelled()) {
+                const auto end = std::min(offset + sample_size, size);
+                results.push_back(invoke_process(process, _begin + static_cast<std::ptrdiff_t>(offset),
+                                                 _begin + static_cast<std::ptrdiff_t>(end), 0));
+                offset = end;
+                sample_size *= 2;
+                elapsed = std::chrono::steady_clock::now() - start;
+            }
+
+            using Nanoseconds = std::chrono::duration<f64, std::nano>;
+            const auto sampled = static_cast<f64>(std::max<usize>(offset, 1));
+            return detail::pick_grain_size(Nanoseconds {elapsed}.count() / sampled, size - offset, num_threads);
+        }
+
+        // Invokes process for every chunk and returns its results in chunk order, chunks skipped after cancellation
+        // keep a default constructed result and are reported through was_cancelled
+        template<typename R, typename F>
+        [[nodiscard]] auto dispatch(F&& process) -> std::vector<R> {
+            const auto size = static_cast<usize>(std::distance(_begin, _end));
+            std::vector<R> results {};
+            _was_cancelled = false;
+            usize offset = 0;
+            auto num_threads = get_thread_count();
+            auto grain = _options.grain_size;
+            if(grain == 0) {
+                grain = sample(process, results, offset, size, num_threads);
+            }
+            if(offset == size) {
+                return results;
+            }
+
+            const auto first_chunk = results.size();
+            const auto num_chunks = (size - offset + grain - 1) / grain;
+            num_threads = std::min(num_threads, num_chunks);
+            results.resize(first_chunk + num_chunks);
+            std::atomic_bool was_cancelled {false};
+            const auto process_chunk = [&](usize chunk, usize worker) {
+                if(_options.cancellation.is_cancelled()) {
+                    was_cancelled.store(true, std::memory_order_relaxed);
+                    return;
+                }
+#ifdef KSTD_STREAMS_PROFILING
+                const profiling::TraceSpan span {"chunk", "parallel"};
+#endif
+                const auto begin = offset + (chunk * grain);
+                const auto end = std::min(begin + grain, size);
+                results[first_chunk + chunk] = invoke_process(process, _begin + static_cast<std::ptrdiff_t>(begin),
+                                                              _begin + static_cast<std::ptrdiff_t>(end), worker);
+            };
+
+            if(num_threads <= 1) {
+                for(usize chunk = 0; chunk < num_chunks; ++chunk) {
+                    process_chunk(chunk, 0);
+                }
+                _was_cancelled = was_cancelled.load(std::memory_order_relaxed);
+                return results;
+            }
+
+            static const std::vector<detail::NumaNode> single_node {{-1, {}}};
+            const auto& nodes = _options.numa_aware ? detail::get_numa_nodes() : single_node;
+            std::vector<detail::ChunkQueue> queues(nodes.size());
+            {
+#ifdef KSTD_STREAMS_PROFILING
+                const profiling::TraceSpan span {"split", "parallel"};
+#endif
+                const auto chunk_nodes = locate_chunks(offset, num_chunks, grain, nodes.size());
+                for(usize chunk = 0; chunk < num_chunks; ++chunk) {
+                    const auto node = std::find_if(nodes.cbegin(), nodes.cend(), [&](const auto& node) {
+                        return node.id == chunk_nodes[chunk];
+                    });
+                    // Chunks on an unknown node are split into contiguous runs, one per node
+                    const auto queue = node != nodes.cend() ? static_cast<usize>(node - nodes.cbegin())
+                                                            : chunk * nodes.size() / num_chunks;
+                    queues[queue].chunks.push_back(chunk);
+                }
+            }
+
+            {
+                std::vector<std::jthread> workers {};
+                workers.reserve(num_threads);
+                for(usize worker = 0; worker < num_threads; ++worker) {
+                    workers.emplace_back([&, worker, home = worker % nodes.size()] {
+                        if(nodes.size() > 1) {
+                            detail::pin_to_cpus(nodes[home].cpus);
+                        }
+                        for(usize offset = 0; offset < queues.size(); ++offset) {
+                            auto& queue = queues[(home + offset) % queues.size()];
+                            auto index = queue.next.fetch_add(1, std::memory_order_relaxed);
+                            while(index < queue.chunks.size()) {
+#ifdef KSTD_STREAMS_PROFILING
+                                // Every chunk taken from the queue of another node is stolen
+                                if(offset > 0) {
+                                    profiling::trace_instant("steal", "parallel");
+                                }
+#endif
+                                process_chunk(queue.chunks[index], worker);
+                                index = queue.next.fetch_add(1, std::memory_order_relaxed);
+                            }
+                        }
+                    });
+                }
+            }
+            _was_cancelled = was_cancelled.load(std::memory_order_relaxed);
+            return results;
+        }
+
+        // Every worker adds the elements of its chunks to a summary of its own, so memory stays fixed
+        // no matter how many chunks there are, and summaries are only merged once per worker
+        template<typename S>
+        [[nodiscard]] auto summarize(S summary) -> S {
+            std::vector<detail::WorkerSlot<S>> slots(get_thread_count(), detail::WorkerSlot<S> {summary});
+            static_cast<void>(dispatch<u8>([&](auto begin, auto end, usize worker) -> u8 {
+                auto& local = slots[worker].value;
+                detail::apply_pipeline(_pipeline, begin, end).for_each([&](auto& element) { local.add(element); });
+                return 0;
+            }));
+#ifdef KSTD_STREAMS_PROFILING
+            const profiling::TraceSpan span {"merge", "parallel"};
+#endif
+            for(const auto& slot : slots) {
+                static_cast<void>(summary.merge(slot.value));
+            }
+            return summary;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(ParallelStream, Self)
+
+        ParallelStream(IteratorType begin, IteratorType end, PipelineType pipeline, ParallelOptions options) noexcept :
+                _begin {begin},
+                _end {end},
+                _pipeline {std::move(pipeline)},
+                _options {options},
+                _was_cancelled {false} {
+        }
+
+        ~ParallelStream() noexcept = default;
+
+        /**
+         * Whether the last terminal skipped chunks because the cancellation token of the options
+         * was cancelled, in which case its result only covers the chunks processed before.
+         */
+        [[nodiscard]] auto was_cancelled() const noexcept -> bool {
+            return _was_cancelled;
+        }
+
+        // The function is invoked concurrently from all workers
+        template<typename F>
+        auto for_each(F function) -> void {
+            static_cast<void>(dispatch<u8>([&](auto begin, auto end) -> u8 {
+                detail::apply_pipeline(_pipeline, begin, end).for_each(function);
+                return 0;
+            }));
+        }
+
+        // Every chunk is reduced on its own, so the initial value is only combined with the first one
+        template<typename F>
+        [[nodiscard]] auto reduce(F function, NakedValueType value = NakedValueType {}) -> NakedValueType {
+            auto results = dispatch<Option<NakedValueType>>([&](auto begin, auto end) {
+                Option<NakedValueType> result {};
+                detail::apply_pipeline(_pipeline, begin, end).for_each([&](auto& element) {
+                    result = result ? function(*result, element) : NakedValueType {element};
+                });
+                return result;
+            });
+#ifdef KSTD_STREAMS_PROFILING
+            const profiling::TraceSpan span {"merge", "parallel"};
+#endif
+            for(auto& result : results) {
+                if(result) {
+                    value = function(value, *result);
+                }
+            }
+            return value;
+        }
+
+        [[nodiscard]] auto sum() -> NakedValueType {
+            return reduce(reducers::add);
+        }
+
+        [[nodiscard]] auto count() -> usize {
+            const auto results = dispatch<usize>([&](auto begin, auto end) {
+                return detail::apply_pipeline(_pipeline, begin, end).count();
+            });
+#ifdef KSTD_STREAMS_PROFILING
+            const profiling::TraceSpan span {"merge", "parallel"};
+#endif
+            usize count = 0;
+            for(const auto chunk_count : results) {
+                count += chunk_count;
+            }
+            return count;
+        }
+
+        // Summarizes the elements of every worker on its own and merges the summaries, see SpaceSaving
+        [[nodiscard]] auto top_frequent(usize k) -> SpaceSaving<NakedValueType> {
+            return summarize(SpaceSaving<NakedValueType> {k});
+        }
+
+        [[nodiscard]] auto frequency_sketch(usize width, usize depth) -> CountMinSketch<NakedValueType> {
+            return summarize(CountMinSketch<NakedValueType> {width, depth});
+        }
+
+        // One vector per chunk, each one allocated and filled on the NUMA node of the worker that produced it
+        [[nodiscard]] auto collect_chunks() -> std::vector<std::vector<NakedValueType>> {
+            return dispatch<std::vector<NakedValueType>>([&](auto begin, auto end) {
+                return detail::apply_pipeline(_pipeline, begin, end).template collect<std::vector>(
+                        collectors::push_back);
+            });
+        }
+
+        [[nodiscard]] auto collect() -> std::vector<NakedValueType> {
+            auto chunks = collect_chunks();
+#ifdef KSTD_STREAMS_PROFILING
+            const profiling::TraceSpan span {"merge", "parallel"};
+#endif
+            usize size = 0;
+            for(const auto& chunk : chunks) {
+                size += chunk.size();
+            }
+            std::vector<NakedValueType> result {};
+            result.reserve(size);
+            for(auto& chunk : chunks) {
+                std::move(chunk.begin(), chunk.end(), std::back_inserter(result));
+            }
+            return result;
+        }
+    };
+
+    /**
+     * Runs the given pipeline over chunks of the given container in parallel, for example:
+     * parallel(values, [](auto stream) { return stream.map([](auto& value) { return value * 2; }); }).sum()
+     */
+    template<typename CONTAINER, typename PIPELINE>
+    [[nodiscard]] auto parallel(CONTAINER& container, PIPELINE pipeline, ParallelOptions options = {}) noexcept
+            -> ParallelStream<decltype(std::begin(container)), PIPELINE> {
+        return {std::begin(container), std::end(container), std::move(pipeline), options};
+    }
+
+    template<typename CONTAINER>
+    [[nodiscard]] auto parallel(CONTAINER& container, ParallelOptions options = {}) noexcept
+            -> ParallelStream<decltype(std::begin(container)), detail::NoPipeline> {
+        return {std::begin(container), std::end(container), detail::NoPipeline {}, options};
+    }
+}// namespace kstd::streams
\ No newline at end of file
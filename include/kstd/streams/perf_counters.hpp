@@ -0,0 +1,168 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "abi.hpp"
+#include "profiler.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI::profiling {
+    /**
+     * A set of hardware performance counters for the calling thread, backed by perf_event_open.
+     * Counters which cannot be opened (unsupported hardware, perf_event_paranoid, containers)
+     * simply stay empty, and on platforms other than Linux all of them do.
+     */
+    struct PerfCounters final {
+        static constexpr usize num_counters = 4;
+
+        private:
+        std::array<i32, num_counters> _descriptors;
+
+#ifdef __linux__
+        [[nodiscard]] static auto open_counter(u64 config) noexcept -> i32 {
+            perf_event_attr attributes {};
+            std::memset(&attributes, 0, sizeof(attributes));
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.size = sizeof(attributes);
+            attributes.config = config;
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            return static_cast<i32>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        }
+
+        [[nodiscard]] auto read_counter(usize index) const noexcept -> Option<u64> {
+            const auto descriptor = _descriptors[index];
+            u64 value = 0;
+            if(descriptor < 0 || ::read(descriptor, &value, sizeof(value)) != sizeof(value)) {
+                return {};
+            }
+            return value;
+        }
+#endif
+
+        public:
+        KSTD_NO_MOVE_COPY(PerfCounters, PerfCounters)
+
+        PerfCounters() noexcept :
+                _descriptors {-1, -1, -1, -1} {
+#ifdef __linux__
+            _descriptors[0] = open_counter(PERF_COUNT_HW_CPU_CYCLES);
+            _descriptors[1] = open_counter(PERF_COUNT_HW_INSTRUCTIONS);
+            _descriptors[2] = open_counter(PERF_COUNT_HW_CACHE_MISSES);
+            _descriptors[3] = open_counter(PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+        }
+
+        ~PerfCounters() noexcept {
+#ifdef __linux__
+            for(const auto descriptor : _descriptors) {
+                if(descriptor >= 0) {
+                    ::close(descriptor);
+                }
+            }
+#endif
+        }
+
+        [[nodiscard]] auto is_available() const noexcept -> bool {
+            for(const auto descriptor : _descriptors) {
+                if(descriptor >= 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        auto start() noexcept -> void {
+#ifdef __linux__
+            for(const auto descriptor : _descriptors) {
+                if(descriptor >= 0) {
+                    ::ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+                    ::ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        [[nodiscard]] auto stop() noexcept -> HardwareCounters {
+#ifdef __linux__
+            for(const auto descriptor : _descriptors) {
+                if(descriptor >= 0) {
+                    ::ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+                }
+            }
+            return {read_counter(0), read_counter(1), read_counter(2), read_counter(3)};
+#else
+            return {};
+#endif
+        }
+    };
+
+    /**
+     * Invokes the given function, usually a terminal operation on a stream, while counting
+     * hardware events, and passes the counts to the given callback before returning the result.
+     */
+    template<typename F, typename C>
+    auto measure_hardware_counters(F&& function, C&& callback) -> std::invoke_result_t<F> {
+        PerfCounters counters {};
+        counters.start();
+        if constexpr(std::is_void_v<std::invoke_result_t<F>>) {
+            function();
+            callback(counters.stop());
+        }
+        else {
+            auto result = function();
+            callback(counters.stop());
+            return result;
+        }
+    }
+
+#ifdef KSTD_STREAMS_PROFILING
+    /**
+     * Like Stream::profile, but additionally attaches the hardware event counts
+     * of the whole terminal execution to the resulting profile.
+     */
+    template<typename STREAM, typename F>
+    auto profile_with_hardware_counters(STREAM& stream, F&& terminal, StreamProfile& profile) -> decltype(auto) {
+        return measure_hardware_counters(
+                [&]() -> decltype(auto) {
+                    return stream.profile(std::forward<F>(terminal), profile);
+                },
+                [&profile](const HardwareCounters& counters) -> void {
+                    profile.set_hardware_counters(counters);
+                });
+    }
+#endif
+}// namespace kstd::streams::profiling
\ No newline at end of file
@@ -19,42 +19,90 @@
 
 #pragma once
 
-#include <functional>
 #include <kstd/defaults.hpp>
 #include <kstd/option.hpp>
+#include <kstd/types.hpp>
 #include <type_traits>
 
-namespace kstd::streams {
-    template<typename PIPE, typename SLEEVE>
+#include "abi.hpp"
+#include "extent.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+#include "status.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    /**
+     * KEEPS_SIZE tells whether the sleeve yields exactly one element per upstream element,
+     * which is what allows the upstream size hint to be forwarded as-is.
+     */
+    template<typename PIPE, typename SLEEVE, usize EXTENT = dynamic_extent, profiling::StageName NAME = "pipe",
+             bool KEEPS_SIZE = true>
     struct Pipe final {
         // clang-format off
         using PipeType      = PIPE;
         using SleeveType    = SLEEVE;
-        using Self          = Pipe<PipeType, SleeveType>;
+        using Self          = Pipe<PipeType, SleeveType, EXTENT, NAME, KEEPS_SIZE>;
         using ValueType     = typename decltype(std::declval<SleeveType>()(std::declval<PipeType&>()))::ValueType;
         // clang-format on
 
+        static constexpr usize extent = EXTENT;
+
+        // Size hints are the exact number of remaining elements or 0 if unknown
+        static constexpr bool keeps_size = KEEPS_SIZE;
+
         private:
         PipeType _pipe;
         SleeveType _sleeve;
+        [[no_unique_address]] profiling::StageProbe<NAME> _probe;
 
         public:
         KSTD_DEFAULT_MOVE_COPY(Pipe, Self, constexpr)
 
         constexpr Pipe() noexcept :
                 _pipe {},
-                _sleeve {} {
+                _sleeve {},
+                _probe {} {
         }
 
         constexpr Pipe(PipeType pipe, SleeveType sleeve) noexcept :
                 _pipe {std::move(pipe)},
-                _sleeve {std::move(sleeve)} {
+                _sleeve {std::move(sleeve)},
+                _probe {} {
         }
 
         ~Pipe() noexcept = default;
 
+        [[nodiscard]] constexpr auto get_size_hint() const noexcept -> usize {
+            if constexpr(keeps_size) {
+                return _pipe.get_size_hint();
+            }
+            else {
+                return 0;
+            }
+        }
+
         [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
-            return _sleeve(_pipe);
+            const auto scope = _probe.enter();
+            auto result = _sleeve(_pipe);
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        [[nodiscard]] constexpr auto get_status() const noexcept -> StreamStatus
+            requires(detail::StatusPipe<PipeType>)
+        {
+            return _pipe.get_status();
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _pipe.collect_profile(profile);
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            _pipe.describe(plan);
+            // Pipes pull from their upstream one element at a time, so they never materialize anything
+            plan.add_stage(_probe.get_name(), "fused, " + detail::describe_extent(extent));
         }
     };
 }// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,78 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/types.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abi.hpp"
+#include "extent.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    struct PlanStage final {
+        const char* name;
+        std::string details;
+    };
+
+    /**
+     * A description of the stages of a stream as they were instantiated, ordered
+     * from the source to the terminal, see Stream::explain.
+     */
+    struct StreamPlan final {
+        private:
+        std::vector<PlanStage> _stages;
+
+        public:
+        StreamPlan() noexcept = default;
+
+        auto add_stage(const char* name, std::string details) -> void {
+            _stages.push_back({name, std::move(details)});
+        }
+
+        [[nodiscard]] auto get_stages() const noexcept -> const std::vector<PlanStage>& {
+            return _stages;
+        }
+
+        [[nodiscard]] auto to_string() const -> std::string {
+            std::string result {};
+            for(const auto& stage : _stages) {
+                result += stage.name;
+                result += ": ";
+                result += stage.details;
+                result += '\n';
+            }
+            return result;
+        }
+    };
+
+    namespace detail {
+        [[nodiscard]] inline auto describe_extent(usize extent) -> std::string {
+            return extent == dynamic_extent ? std::string {"dynamic extent"}
+                                            : "static extent " + std::to_string(extent);
+        }
+
+        [[nodiscard]] inline auto describe_size(usize size_hint) -> std::string {
+            return size_hint == 0 ? std::string {"size unknown"} : "size " + std::to_string(size_hint);
+        }
+    }// namespace detail
+}// namespace kstd::streams
\ No newline at end of file
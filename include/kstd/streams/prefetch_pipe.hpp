@@ -0,0 +1,210 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "abi.hpp"
+#include "extent.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+#include "status.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    namespace detail {
+        // Enough elements ahead to hide a miss to DRAM behind the work on the elements in between
+        constexpr usize default_prefetch_distance = 16;
+
+        // Only a hint, so it is skipped during constant evaluation where there is no cache to warm up
+        constexpr auto prefetch_address(const void* address) noexcept -> void {
+            if(std::is_constant_evaluated()) {
+                return;
+            }
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address, 0, 3);
+#else
+            static_cast<void>(address);
+#endif
+        }
+
+        // Sources which can hand out the element some distance ahead without consuming anything
+        template<typename PIPE>
+        concept LookaheadPipe = requires(const PIPE& pipe, usize distance) {
+            { pipe.peek_ahead(distance) };
+        };
+
+        // The elements a PrefetchPipe has read ahead of a source which can not be peeked into
+        template<typename T>
+        struct PrefetchRing final {
+            std::vector<T> buffer;
+            usize head = 0;
+            usize size = 0;
+            bool is_exhausted = false;
+        };
+
+        struct NoPrefetchRing final {};
+    }// namespace detail
+
+    /**
+     * Forwards the pointers (or references) of its upstream pipe unchanged, but prefetches their
+     * pointees (and the given fields of them) distance elements ahead of the one being returned.
+     * Lookahead sources are peeked into, any other upstream pipe is read ahead into a
+     * ring buffer of distance elements. Reading ahead runs the upstream stages distance
+     * elements early, and is useless for linked sources which dereference every element.
+     */
+    template<typename PIPE, auto... FIELDS>
+    struct PrefetchPipe final {
+        // clang-format off
+        using PipeType    = PIPE;
+        using Self        = PrefetchPipe<PipeType, FIELDS...>;
+        using ValueType   = typename PipeType::ValueType;
+        using PointerType = std::add_pointer_t<std::remove_pointer_t<std::remove_reference_t<ValueType>>>;
+        // clang-format on
+
+        static_assert(std::is_pointer_v<ValueType> || std::is_lvalue_reference_v<ValueType>,
+                      "Only streams of pointers or references can be prefetched");
+
+        static constexpr usize extent = pipe_extent<PipeType>;
+        static constexpr bool is_lookahead = detail::LookaheadPipe<PipeType>;
+
+        private:
+        PipeType _pipe;
+        usize _distance;
+        [[no_unique_address]] std::conditional_t<is_lookahead, detail::NoPrefetchRing,
+                                                 detail::PrefetchRing<PointerType>> _ring;
+        [[no_unique_address]] profiling::StageProbe<"prefetch"> _probe;
+
+        // References are kept as pointers in the ring, as a vector can not hold them
+        [[nodiscard]] static constexpr auto to_pointer(ValueType value) noexcept -> PointerType {
+            if constexpr(std::is_pointer_v<ValueType>) {
+                return value;
+            }
+            else {
+                return std::addressof(value);
+            }
+        }
+
+        [[nodiscard]] static constexpr auto from_pointer(PointerType pointer) noexcept -> ValueType {
+            if constexpr(std::is_pointer_v<ValueType>) {
+                return pointer;
+            }
+            else {
+                return *pointer;
+            }
+        }
+
+        static constexpr auto prefetch(PointerType pointer) noexcept -> void {
+            if(pointer == nullptr) {
+                return;
+            }
+            detail::prefetch_address(pointer);
+            (detail::prefetch_address(&(pointer->*FIELDS)), ...);
+        }
+
+        [[nodiscard]] constexpr auto read_next() noexcept -> Option<ValueType> {
+            if constexpr(is_lookahead) {
+                if(const auto ahead = _pipe.peek_ahead(_distance)) {
+                    prefetch(to_pointer(*ahead));
+                }
+                return _pipe.get_next();
+            }
+            else {
+                const auto capacity = _ring.buffer.size();
+                while(!_ring.is_exhausted && _ring.size < capacity) {
+                    auto element = _pipe.get_next();
+                    if(!element) {
+                        _ring.is_exhausted = true;
+                        break;
+                    }
+                    const auto pointer = to_pointer(*element);
+                    prefetch(pointer);
+                    _ring.buffer[(_ring.head + _ring.size) % capacity] = pointer;
+                    ++_ring.size;
+                }
+                if(_ring.size == 0) {
+                    return {};
+                }
+                const auto pointer = _ring.buffer[_ring.head];
+                _ring.head = (_ring.head + 1) % capacity;
+                --_ring.size;
+                return from_pointer(pointer);
+            }
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(PrefetchPipe, Self, constexpr)
+
+        constexpr PrefetchPipe(PipeType pipe, usize distance) noexcept :
+                _pipe {std::move(pipe)},
+                _distance {distance},
+                _ring {},
+                _probe {} {
+            if constexpr(!is_lookahead) {
+                _ring.buffer.resize(distance > 0 ? distance : 1);
+            }
+        }
+
+        ~PrefetchPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_size_hint() const noexcept -> usize {
+            const auto hint = _pipe.get_size_hint();
+            if constexpr(is_lookahead) {
+                return hint;
+            }
+            else {
+                return hint == 0 && !_ring.is_exhausted ? 0 : hint + _ring.size;
+            }
+        }
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        [[nodiscard]] constexpr auto get_status() const noexcept -> StreamStatus
+            requires(detail::StatusPipe<PipeType>)
+        {
+            return _pipe.get_status();
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _pipe.collect_profile(profile);
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            _pipe.describe(plan);
+            plan.add_stage(_probe.get_name(), std::to_string(_distance) + " elements ahead, " +
+                                                      std::to_string(sizeof...(FIELDS)) + " extra fields, " +
+                                                      (is_lookahead ? "peeks into its source" : "reads ahead") +
+                                                      ", " + detail::describe_extent(extent));
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
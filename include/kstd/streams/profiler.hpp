@@ -0,0 +1,329 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+
+#include "abi.hpp"
+
+#ifdef KSTD_STREAMS_PROFILING
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define KSTD_STREAMS_PROFILING_RDTSC
+#endif
+#endif// KSTD_STREAMS_PROFILING
+
+/**
+ * Per-stage profiling is compiled in by defining KSTD_STREAMS_PROFILING before including
+ * any kstd-streams header. Without it, every probe is an empty no-op and costs nothing.
+ *
+ * To have allocations attributed to stages, place KSTD_STREAMS_DEFINE_PROFILING_ALLOCATOR()
+ * in exactly one translation unit, or call kstd::streams::profiling::record_allocation
+ * from an existing global operator new.
+ */
+#ifdef KSTD_STREAMS_PROFILING
+#define KSTD_STREAMS_DEFINE_PROFILING_ALLOCATOR()                                                                      \
+    auto operator new(std::size_t size) -> void* {                                                                     \
+        kstd::streams::profiling::record_allocation(size);                                                            \
+        if(auto* memory = std::malloc(size == 0 ? 1 : size)) {                                                         \
+            return memory;                                                                                             \
+        }                                                                                                              \
+        throw std::bad_alloc {};                                                                                       \
+    }                                                                                                                  \
+    auto operator delete(void* memory) noexcept -> void {                                                              \
+        std::free(memory);                                                                                             \
+    }                                                                                                                  \
+    auto operator delete(void* memory, std::size_t) noexcept -> void {                                                 \
+        std::free(memory);                                                                                             \
+    }
+#else
+#define KSTD_STREAMS_DEFINE_PROFILING_ALLOCATOR()
+#endif
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI::profiling {
+    /**
+     * Hardware event counts of a single pipeline execution, see perf_counters.hpp.
+     * Counters the host cannot provide are left empty.
+     */
+    struct HardwareCounters final {
+        Option<u64> cycles;
+        Option<u64> instructions;
+        Option<u64> cache_misses;
+        Option<u64> branch_misses;
+    };
+
+    /**
+     * The name of a stage, passed to its probe as a template argument, so
+     * a disabled probe does not need to store it and stays empty.
+     */
+    template<usize SIZE>
+    struct StageName final {
+        char value[SIZE] {};// NOLINT: has to be an array to be usable as a template argument
+
+        constexpr StageName(const char (&name)[SIZE]) noexcept {// NOLINT: converts from string literals implicitly
+            for(usize index = 0; index < SIZE; ++index) {
+                value[index] = name[index];
+            }
+        }
+    };
+
+#ifdef KSTD_STREAMS_PROFILING
+    struct StageProfile final {
+        const char* name;
+        usize elements_in;
+        usize elements_out;
+        u64 cycles;
+        usize allocations;
+        usize allocated_bytes;
+    };
+
+    struct AllocationCounters final {
+        usize allocations;
+        usize allocated_bytes;
+    };
+
+    [[nodiscard]] inline auto get_allocation_counters() noexcept -> AllocationCounters& {
+        thread_local AllocationCounters counters {};
+        return counters;
+    }
+
+    inline auto record_allocation(usize size) noexcept -> void {
+        auto& counters = get_allocation_counters();
+        ++counters.allocations;
+        counters.allocated_bytes += size;
+    }
+
+    [[nodiscard]] inline auto read_timestamp() noexcept -> u64 {
+#ifdef KSTD_STREAMS_PROFILING_RDTSC
+        return __rdtsc();
+#else
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+#endif
+    }
+
+    /**
+     * The profile of a whole pipeline, ordered from the source to the terminal.
+     */
+    struct StreamProfile final {
+        private:
+        std::vector<StageProfile> _stages;
+        Option<HardwareCounters> _hardware_counters;
+
+        public:
+        constexpr StreamProfile() noexcept = default;
+
+        constexpr auto add_stage(const StageProfile& stage) -> void {
+            _stages.push_back(stage);
+        }
+
+        auto finalize() noexcept -> void {
+            for(usize index = 0; index < _stages.size(); ++index) {
+                auto& stage = _stages[index];
+                stage.elements_in = index == 0 ? stage.elements_out : _stages[index - 1].elements_out;
+            }
+        }
+
+        [[nodiscard]] constexpr auto get_stages() const noexcept -> const std::vector<StageProfile>& {
+            return _stages;
+        }
+
+        auto set_hardware_counters(const HardwareCounters& counters) noexcept -> void {
+            _hardware_counters = counters;
+        }
+
+        [[nodiscard]] auto get_hardware_counters() const noexcept -> const Option<HardwareCounters>& {
+            return _hardware_counters;
+        }
+
+        [[nodiscard]] auto get_total_cycles() const noexcept -> u64 {
+            u64 cycles = 0;
+            for(const auto& stage : _stages) {
+                cycles += stage.cycles;
+            }
+            return cycles;
+        }
+
+        [[nodiscard]] auto to_string() const -> std::string {
+            const auto total_cycles = get_total_cycles();
+            std::string result {};
+            for(const auto& stage : _stages) {
+                const auto selectivity = stage.elements_in == 0 ? 1.0
+                                                                : static_cast<f64>(stage.elements_out) /
+                                                                          static_cast<f64>(stage.elements_in);
+                const auto share = total_cycles == 0 ? 0.0
+                                                     : static_cast<f64>(stage.cycles) /
+                                                               static_cast<f64>(total_cycles) * 100.0;
+                result += stage.name;
+                result += ": in=" + std::to_string(stage.elements_in);
+                result += " out=" + std::to_string(stage.elements_out);
+                result += " selectivity=" + std::to_string(selectivity);
+                result += " cycles=" + std::to_string(stage.cycles);
+                result += " (" + std::to_string(share) + "%)";
+                result += " allocations=" + std::to_string(stage.allocations);
+                result += " allocated_bytes=" + std::to_string(stage.allocated_bytes);
+                result += '\n';
+            }
+            if(_hardware_counters) {
+                const auto append_counter = [&result](const char* name, const Option<u64>& value) -> void {
+                    result += name;
+                    result += value ? std::to_string(*value) : std::string {"n/a"};
+                };
+                const auto& counters = *_hardware_counters;
+                append_counter("hardware: cycles=", counters.cycles);
+                append_counter(" instructions=", counters.instructions);
+                append_counter(" cache_misses=", counters.cache_misses);
+                append_counter(" branch_misses=", counters.branch_misses);
+                result += '\n';
+            }
+            return result;
+        }
+    };
+
+    /**
+     * The cost spent inside nested probes since the innermost active probe was entered.
+     * Every probe subtracts it from its own elapsed cost, so stages only record their exclusive cost.
+     */
+    struct NestedCost final {
+        u64 cycles;
+        usize allocations;
+        usize allocated_bytes;
+    };
+
+    [[nodiscard]] inline auto get_nested_cost() noexcept -> NestedCost& {
+        thread_local NestedCost cost {};
+        return cost;
+    }
+
+    struct ProbeScope final {
+        u64 timestamp;
+        usize allocations;
+        usize allocated_bytes;
+        NestedCost outer;
+    };
+
+    template<StageName NAME>
+    struct StageProbe final {
+        private:
+        StageProfile _profile;
+        std::vector<StageProfile> _upstream;
+
+        public:
+        constexpr StageProbe() noexcept :
+                _profile {NAME.value, 0, 0, 0, 0, 0},
+                _upstream {} {
+        }
+
+        [[nodiscard]] constexpr auto enter() const noexcept -> ProbeScope {
+            if(std::is_constant_evaluated()) {
+                return {};
+            }
+            auto& nested = get_nested_cost();
+            const auto outer = nested;
+            nested = {};
+            const auto& counters = get_allocation_counters();
+            return {read_timestamp(), counters.allocations, counters.allocated_bytes, outer};
+        }
+
+        constexpr auto leave(const ProbeScope& scope, bool produced) noexcept -> void {
+            if(std::is_constant_evaluated()) {
+                return;
+            }
+            const auto& counters = get_allocation_counters();
+            const auto cycles = read_timestamp() - scope.timestamp;
+            const auto allocations = counters.allocations - scope.allocations;
+            const auto allocated_bytes = counters.allocated_bytes - scope.allocated_bytes;
+
+            auto& nested = get_nested_cost();
+            _profile.cycles += cycles - std::min(cycles, nested.cycles);
+            _profile.allocations += allocations - std::min(allocations, nested.allocations);
+            _profile.allocated_bytes += allocated_bytes - std::min(allocated_bytes, nested.allocated_bytes);
+            nested = {scope.outer.cycles + cycles,
+                      scope.outer.allocations + allocations,
+                      scope.outer.allocated_bytes + allocated_bytes};
+
+            if(produced) {
+                ++_profile.elements_out;
+            }
+        }
+
+        /**
+         * Buffering stages drain and destroy their upstream pipe on construction,
+         * so its stages are copied into the probe to outlive it.
+         */
+        template<typename PIPE>
+        constexpr auto capture_upstream(const PIPE& pipe) -> void {
+            StreamProfile profile {};
+            pipe.collect_profile(profile);
+            _upstream = profile.get_stages();
+        }
+
+        [[nodiscard]] constexpr auto get_name() const noexcept -> const char* {
+            return _profile.name;
+        }
+
+        constexpr auto collect_profile(StreamProfile& profile) const -> void {
+            for(const auto& stage : _upstream) {
+                profile.add_stage(stage);
+            }
+            profile.add_stage(_profile);
+        }
+    };
+#else
+    struct StreamProfile;
+
+    struct ProbeScope final {};
+
+    template<StageName NAME>
+    struct StageProbe final {
+        [[nodiscard]] constexpr auto get_name() const noexcept -> const char* {
+            return NAME.value;
+        }
+
+        [[nodiscard]] constexpr auto enter() const noexcept -> ProbeScope {
+            return {};
+        }
+
+        constexpr auto leave(const ProbeScope&, bool) noexcept -> void {
+        }
+
+        template<typename PIPE>
+        constexpr auto capture_upstream(const PIPE&) noexcept -> void {
+        }
+
+        constexpr auto collect_profile(StreamProfile&) const noexcept -> void {
+        }
+    };
+#endif
+}// namespace kstd::streams::profiling
\ No newline at end of file
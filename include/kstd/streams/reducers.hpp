@@ -19,7 +19,9 @@
 
 #pragma once
 
-namespace kstd::streams::reducers {
+#include "abi.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI::reducers {
     constexpr auto add = [](auto& current, auto& value) noexcept -> auto {
         return current + value;
     };
@@ -0,0 +1,144 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <chrono>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+#include <utility>
+
+#include "abi.hpp"
+#include "core.hpp"
+#include "status.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    namespace detail {
+        static constexpr usize max_resumable_batch = 1024;// Elements between two clock reads in run_for
+    }
+
+    /**
+     * Invokes a function on the elements of a pipe a slice at a time, so a heavy stream can be
+     * interleaved with other work on the same thread, like the callbacks of an event loop.
+     * All progress lives in the task, which can be moved around freely between slices.
+     */
+    template<typename PIPE, typename F>
+    struct ResumableTask final {
+        // clang-format off
+        using PipeType      = PIPE;
+        using FunctionType  = F;
+        using Self          = ResumableTask<PipeType, FunctionType>;
+        using Clock         = std::chrono::steady_clock;
+        // clang-format on
+
+        static_assert(std::is_invocable_v<FunctionType&, typename PipeType::ValueType&>,
+                      "Function signature does not match");
+
+        private:
+        PipeType _pipe;
+        FunctionType _function;
+        usize _processed;
+        bool _is_done;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(ResumableTask, Self)
+
+        ResumableTask(PipeType pipe, FunctionType function) noexcept :
+                _pipe {std::move(pipe)},
+                _function {std::move(function)},
+                _processed {0},
+                _is_done {false} {
+        }
+
+        ~ResumableTask() noexcept = default;
+
+        // Processes at most the given number of elements, returns true once the stream is exhausted
+        auto step(usize max_elements) noexcept -> bool {
+            for(usize index = 0; index < max_elements && !_is_done; ++index) {
+                auto element = _pipe.get_next();
+                if(!element) {
+                    _is_done = true;
+                    break;
+                }
+                _function(*element);
+                ++_processed;
+            }
+            return _is_done;
+        }
+
+        /**
+         * Processes elements until the given budget is used up, returns true once the stream is exhausted.
+         * The clock is only read between batches, which are sized from the time taken per element so far,
+         * so a call may overrun its budget by about the time it takes to process a single element.
+         */
+        auto run_for(Clock::duration budget) noexcept -> bool {
+            const auto start = Clock::now();
+            const auto first = _processed;
+            usize batch_size = 1;
+            while(!step(batch_size)) {
+                const auto elapsed = Clock::now() - start;
+                if(elapsed >= budget) {
+                    break;
+                }
+                // Aim for half of the remaining budget, so the last batch does not overshoot
+                const auto processed = static_cast<Clock::rep>(_processed - first);
+                auto cost = elapsed.count() / processed;
+                if(cost < 1) {
+                    cost = 1;
+                }
+                batch_size = static_cast<usize>((budget - elapsed).count() / cost) / 2;
+                if(batch_size < 1) {
+                    batch_size = 1;
+                }
+                else if(batch_size > detail::max_resumable_batch) {
+                    batch_size = detail::max_resumable_batch;
+                }
+            }
+            return _is_done;
+        }
+
+        [[nodiscard]] auto is_done() const noexcept -> bool {
+            return _is_done;
+        }
+
+        // Whether the task is done because a stage of its stream was cancelled, see Stream::was_cancelled
+        [[nodiscard]] auto was_cancelled() const noexcept -> bool {
+            return detail::get_upstream_status(_pipe).is_cancelled;
+        }
+
+        // Whether a stage of its stream lost elements to an I/O error, see Stream::has_failed
+        [[nodiscard]] auto has_failed() const noexcept -> bool {
+            return detail::get_upstream_status(_pipe).has_failed;
+        }
+
+        [[nodiscard]] auto get_processed() const noexcept -> usize {
+            return _processed;
+        }
+
+        [[nodiscard]] auto get_function() noexcept -> FunctionType& {
+            return _function;
+        }
+
+        [[nodiscard]] auto get_function() const noexcept -> const FunctionType& {
+            return _function;
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
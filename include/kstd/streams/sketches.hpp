@@ -0,0 +1,291 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abi.hpp"
+#include "core.hpp"
+#include "hash.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    template<typename T>
+    struct FrequentElement final {
+        T value;
+        u64 count; // Upper bound of the true frequency
+        u64 error; // Maximum overestimation, count - error is a lower bound of the true frequency
+    };
+
+    /**
+     * Space-Saving summary of the most frequent elements of a stream, keeping at most
+     * capacity counters. Every element whose true frequency is above total / capacity
+     * is guaranteed to be in the summary. Summaries of disjoint partitions can be merged.
+     */
+    template<typename T, typename HASH = std::hash<T>>
+    struct SpaceSaving final {
+        using ValueType = T;
+        using ElementType = FrequentElement<T>;
+
+        private:
+        std::vector<ElementType> _heap;// Min-heap by count, the root is replaced on eviction
+        std::unordered_map<T, usize, HASH> _positions;
+        usize _capacity;
+        u64 _total;
+
+        auto swap_elements(usize first, usize second) noexcept -> void {
+            std::swap(_heap[first], _heap[second]);
+            _positions.find(_heap[first].value)->second = first;
+            _positions.find(_heap[second].value)->second = second;
+        }
+
+        auto sift_up(usize index) noexcept -> void {
+            while(index > 0) {
+                const auto parent = (index - 1) >> 1;
+                if(_heap[parent].count <= _heap[index].count) {
+                    break;
+                }
+                swap_elements(index, parent);
+                index = parent;
+            }
+        }
+
+        auto sift_down(usize index) noexcept -> void {
+            const auto size = _heap.size();
+            while(true) {
+                auto smallest = index;
+                const auto left = (index << 1) + 1;
+                const auto right = left + 1;
+                if(left < size && _heap[left].count < _heap[smallest].count) {
+                    smallest = left;
+                }
+                if(right < size && _heap[right].count < _heap[smallest].count) {
+                    smallest = right;
+                }
+                if(smallest == index) {
+                    break;
+                }
+                swap_elements(index, smallest);
+                index = smallest;
+            }
+        }
+
+        auto rebuild(std::vector<ElementType> elements) noexcept -> void {
+            _heap = std::move(elements);
+            std::make_heap(_heap.begin(), _heap.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.count > rhs.count;
+            });
+            _positions.clear();
+            for(usize index = 0; index < _heap.size(); ++index) {
+                _positions.emplace(_heap[index].value, index);
+            }
+        }
+
+        public:
+        explicit SpaceSaving(usize capacity = 0) noexcept :
+                _heap(),
+                _positions(),
+                _capacity(capacity),
+                _total(0) {
+            _heap.reserve(capacity);
+            _positions.reserve(capacity);
+        }
+
+        KSTD_DEFAULT_MOVE_COPY(SpaceSaving, SpaceSaving)
+        ~SpaceSaving() noexcept = default;
+
+        auto add(const T& value, u64 count = 1) noexcept -> void {
+            if(_capacity == 0) {
+                return;
+            }
+            _total += count;
+            if(const auto position = _positions.find(value); position != _positions.end()) {
+                const auto index = position->second;
+                _heap[index].count += count;
+                sift_down(index);
+                return;
+            }
+            if(_heap.size() < _capacity) {
+                _positions.emplace(value, _heap.size());
+                _heap.push_back({value, count, 0});
+                sift_up(_heap.size() - 1);
+                return;
+            }
+            // Evict the least frequent element, the newcomer inherits its count as error
+            auto& minimum = _heap.front();
+            _positions.erase(minimum.value);
+            minimum.value = value;
+            minimum.error = minimum.count;
+            minimum.count += count;
+            _positions.emplace(value, 0);
+            sift_down(0);
+        }
+
+        // Combines the summary of another partition into this one, see Agarwal et al., "Mergeable Summaries"
+        auto merge(const SpaceSaving& other) noexcept -> void {
+            const auto minimum = get_minimum_count();
+            const auto other_minimum = other.get_minimum_count();
+            std::vector<ElementType> elements {};
+            elements.reserve(_heap.size() + other._heap.size());
+            for(const auto& element : _heap) {
+                auto merged = element;
+                if(const auto position = other._positions.find(element.value); position != other._positions.end()) {
+                    merged.count += other._heap[position->second].count;
+                    merged.error += other._heap[position->second].error;
+                }
+                else {
+                    merged.count += other_minimum;
+                    merged.error += other_minimum;
+                }
+                elements.push_back(std::move(merged));
+            }
+            for(const auto& element : other._heap) {
+                if(_positions.find(element.value) == _positions.end()) {
+                    elements.push_back({element.value, element.count + minimum, element.error + minimum});
+                }
+            }
+            if(elements.size() > _capacity) {
+                std::nth_element(elements.begin(), elements.begin() + static_cast<std::ptrdiff_t>(_capacity),
+                                 elements.end(), [](const auto& lhs, const auto& rhs) {
+                                     return lhs.count > rhs.count;
+                                 });
+                elements.resize(_capacity);
+            }
+            _total += other._total;
+            rebuild(std::move(elements));
+        }
+
+        // Upper bound of the frequency of the given value
+        [[nodiscard]] auto estimate(const T& value) const noexcept -> u64 {
+            if(const auto position = _positions.find(value); position != _positions.end()) {
+                return _heap[position->second].count;
+            }
+            return get_minimum_count();
+        }
+
+        // The tracked elements, most frequent first
+        [[nodiscard]] auto get_elements() const noexcept -> std::vector<ElementType> {
+            auto elements = _heap;
+            std::sort(elements.begin(), elements.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.count > rhs.count;
+            });
+            return elements;
+        }
+
+        [[nodiscard]] auto get_minimum_count() const noexcept -> u64 {
+            return _heap.size() < _capacity || _heap.empty() ? 0 : _heap.front().count;
+        }
+
+        [[nodiscard]] auto get_capacity() const noexcept -> usize {
+            return _capacity;
+        }
+
+        [[nodiscard]] auto get_size() const noexcept -> usize {
+            return _heap.size();
+        }
+
+        [[nodiscard]] auto get_total() const noexcept -> u64 {
+            return _total;
+        }
+    };
+
+    /**
+     * Count-Min sketch of the frequencies of a stream in width * depth counters. Estimates
+     * never undercount and overcount by at most e / width * total with a probability of
+     * 1 - e^-depth. Sketches of the same dimensions can be merged by adding their counters.
+     */
+    template<typename T, typename HASH = std::hash<T>>
+    struct CountMinSketch final {
+        using ValueType = T;
+
+        private:
+        std::vector<u64> _counters;
+        usize _width;
+        usize _depth;
+        u64 _total;
+        [[no_unique_address]] HASH _hash;
+
+        public:
+        explicit CountMinSketch(usize width = 0, usize depth = 0) noexcept :
+                _counters(width * depth),
+                _width(width),
+                _depth(depth),
+                _total(0),
+                _hash() {
+        }
+
+        KSTD_DEFAULT_MOVE_COPY(CountMinSketch, CountMinSketch)
+        ~CountMinSketch() noexcept = default;
+
+        auto add(const T& value, u64 count = 1) noexcept -> void {
+            if(_width == 0) {
+                return;
+            }
+            _total += count;
+            const auto hash = static_cast<usize>(_hash(value));
+            for(usize row = 0; row < _depth; ++row) {
+                _counters[row * _width + detail::mix_hash(hash, row) % _width] += count;
+            }
+        }
+
+        // Returns false without changing this sketch if the dimensions of both sketches differ
+        auto merge(const CountMinSketch& other) noexcept -> bool {
+            if(_width != other._width || _depth != other._depth) {
+                return false;
+            }
+            for(usize index = 0; index < _counters.size(); ++index) {
+                _counters[index] += other._counters[index];
+            }
+            _total += other._total;
+            return true;
+        }
+
+        // Upper bound of the frequency of the given value
+        [[nodiscard]] auto estimate(const T& value) const noexcept -> u64 {
+            if(_width == 0 || _depth == 0) {
+                return _total;
+            }
+            const auto hash = static_cast<usize>(_hash(value));
+            auto result = _counters[detail::mix_hash(hash, 0) % _width];
+            for(usize row = 1; row < _depth; ++row) {
+                result = std::min(result, _counters[row * _width + detail::mix_hash(hash, row) % _width]);
+            }
+            return result;
+        }
+
+        [[nodiscard]] auto get_width() const noexcept -> usize {
+            return _width;
+        }
+
+        [[nodiscard]] auto get_depth() const noexcept -> usize {
+            return _depth;
+        }
+
+        [[nodiscard]] auto get_total() const noexcept -> u64 {
+            return _total;
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
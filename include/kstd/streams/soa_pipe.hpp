@@ -0,0 +1,106 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <iterator>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <tuple>
+#include <type_traits>
+
+#include "abi.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    /**
+     * Zips a set of parallel columns into record views. Each view only holds
+     * references into the columns, so projecting a single field out of it only
+     * ever touches the memory of that one column.
+     * Views are yielded by value, they are cheap to copy and stay bound to their row.
+     */
+    template<typename VIEW, typename... ITERATORS>
+    struct SoaPipe final {
+        // clang-format off
+        using ViewType      = VIEW;
+        using Iterators     = std::tuple<ITERATORS...>;
+        using Self          = SoaPipe<ViewType, ITERATORS...>;
+        using ValueType     = ViewType;
+        // clang-format on
+
+        static_assert(sizeof...(ITERATORS) > 0, "SoaPipe requires at least one column");
+
+        private:
+        Iterators _current;
+        usize _remaining;
+        [[no_unique_address]] profiling::StageProbe<"soa"> _probe;
+
+        [[nodiscard]] constexpr auto read_next() noexcept -> Option<ValueType> {
+            if(_remaining == 0) {
+                return {};
+            }
+            --_remaining;
+            return std::apply(
+                    [this](auto&... iterators) noexcept -> ValueType {
+                        return ViewType {*(iterators++)...};
+                    },
+                    _current);
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(SoaPipe, Self, constexpr)
+
+        constexpr SoaPipe() noexcept :
+                _current {},
+                _remaining {0},
+                _probe {} {
+        }
+
+        constexpr SoaPipe(Iterators begin, usize size) noexcept :
+                _current {std::move(begin)},
+                _remaining {size},
+                _probe {} {
+        }
+
+        ~SoaPipe() noexcept = default;
+
+        [[nodiscard]] constexpr auto get_size_hint() const noexcept -> usize {
+            return _remaining;
+        }
+
+        [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            auto details = std::to_string(sizeof...(ITERATORS)) + " columns, " + detail::describe_size(_remaining);
+            plan.add_stage(_probe.get_name(), std::move(details) + ", splittable");
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,564 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "abi.hpp"
+#include "core.hpp"
+#include "hash.hpp"
+#include "status.hpp"
+
+#ifdef KSTD_STREAMS_PROFILING
+#include "trace.hpp"
+#endif
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    /**
+     * Limits how much memory the hash table of a distinct or group_by stage may use.
+     * Once the limit is reached, all elements which are not already in the table are
+     * hash-partitioned into temporary files, which are processed the same way afterwards.
+     */
+    struct MemoryBudget final {
+        usize max_bytes = std::numeric_limits<usize>::max();
+        const char* directory = nullptr;// Defaults to the temporary directory of the system
+    };
+
+    namespace detail {
+        static constexpr usize spill_partitions = 16;
+        static constexpr u32 max_spill_depth = 8;// Past this depth, partitions are kept in memory regardless
+
+        /*
+         * Binary encoding of the elements written to spill files. Spilled
+         * elements never leave the process, so the native layout is fine.
+         */
+        template<typename T, typename = void>
+        struct SpillCodec;
+
+        template<typename T>
+        struct SpillCodec<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> final {
+            static auto write(std::ostream& stream, const T& value) -> void {
+                stream.write(reinterpret_cast<const char*>(&value), sizeof(T));// NOLINT
+            }
+
+            [[nodiscard]] static auto read(std::istream& stream) -> Option<T> {
+                std::array<char, sizeof(T)> bytes {};
+                if(!stream.read(bytes.data(), sizeof(T))) {
+                    return {};
+                }
+                return std::bit_cast<T>(bytes);
+            }
+
+            [[nodiscard]] static constexpr auto get_heap_size(const T&) noexcept -> usize {
+                return 0;
+            }
+        };
+
+        template<typename C, typename TRAITS, typename ALLOCATOR>
+        struct SpillCodec<std::basic_string<C, TRAITS, ALLOCATOR>> final {
+            using Type = std::basic_string<C, TRAITS, ALLOCATOR>;
+
+            static auto write(std::ostream& stream, const Type& value) -> void {
+                SpillCodec<usize>::write(stream, value.size());
+                stream.write(reinterpret_cast<const char*>(value.data()), value.size() * sizeof(C));// NOLINT
+            }
+
+            [[nodiscard]] static auto read(std::istream& stream) -> Option<Type> {
+                const auto size = SpillCodec<usize>::read(stream);
+                if(!size) {
+                    return {};
+                }
+                Type value(*size, C {});
+                if(!stream.read(reinterpret_cast<char*>(value.data()), *size * sizeof(C))) {// NOLINT
+                    return {};
+                }
+                return value;
+            }
+
+            [[nodiscard]] static constexpr auto get_heap_size(const Type& value) noexcept -> usize {
+                return value.capacity() * sizeof(C);
+            }
+        };
+
+        template<typename FIRST, typename SECOND>
+        struct SpillCodec<std::pair<FIRST, SECOND>,
+                          std::enable_if_t<!std::is_trivially_copyable_v<std::pair<FIRST, SECOND>>>> final {
+            using Type = std::pair<FIRST, SECOND>;
+
+            static auto write(std::ostream& stream, const Type& value) -> void {
+                SpillCodec<FIRST>::write(stream, value.first);
+                SpillCodec<SECOND>::write(stream, value.second);
+            }
+
+            [[nodiscard]] static auto read(std::istream& stream) -> Option<Type> {
+                auto first = SpillCodec<FIRST>::read(stream);
+                if(!first) {
+                    return {};
+                }
+                auto second = SpillCodec<SECOND>::read(stream);
+                if(!second) {
+                    return {};
+                }
+                return Type {std::move(*first), std::move(*second)};
+            }
+
+            [[nodiscard]] static constexpr auto get_heap_size(const Type& value) noexcept -> usize {
+                return SpillCodec<FIRST>::get_heap_size(value.first) + SpillCodec<SECOND>::get_heap_size(value.second);
+            }
+        };
+
+        // Whether there is a SpillCodec for T, checked up front for a readable error
+        template<typename T>
+        struct IsSpillable : std::is_trivially_copyable<T> {};
+
+        template<typename C, typename TRAITS, typename ALLOCATOR>
+        struct IsSpillable<std::basic_string<C, TRAITS, ALLOCATOR>> : std::true_type {};
+
+        template<typename FIRST, typename SECOND>
+        struct IsSpillable<std::pair<FIRST, SECOND>>
+                : std::bool_constant<std::is_trivially_copyable_v<std::pair<FIRST, SECOND>> ||
+                                     (IsSpillable<FIRST>::value && IsSpillable<SECOND>::value)> {};
+
+        template<typename T>
+        concept Spillable = IsSpillable<T>::value;
+
+        template<typename T>
+        struct SpillFile final {
+            private:
+            std::filesystem::path _path;
+            std::fstream _stream;
+            usize _size;
+            u32 _level;
+
+            SpillFile(std::filesystem::path path, std::fstream stream, u32 level) noexcept :
+                    _path {std::move(path)},
+                    _stream {std::move(stream)},
+                    _size {0},
+                    _level {level} {
+            }
+
+            public:
+            SpillFile(const SpillFile&) = delete;
+            auto operator=(const SpillFile&) -> SpillFile& = delete;
+
+            SpillFile(SpillFile&& other) noexcept :
+                    _path {std::exchange(other._path, {})},
+                    _stream {std::move(other._stream)},
+                    _size {other._size},
+                    _level {other._level} {
+            }
+
+            auto operator=(SpillFile&& other) noexcept -> SpillFile& {
+                if(this != &other) {
+                    remove();
+                    _path = std::exchange(other._path, {});
+                    _stream = std::move(other._stream);
+                    _size = other._size;
+                    _level = other._level;
+                }
+                return *this;
+            }
+
+            ~SpillFile() noexcept {
+                remove();
+            }
+
+            [[nodiscard]] static auto create(const MemoryBudget& budget, u32 level) -> Option<SpillFile> {
+                std::error_code error {};
+                std::filesystem::path directory {};
+                if(budget.directory != nullptr) {
+                    directory = budget.directory;
+                }
+                else {
+                    directory = std::filesystem::temp_directory_path(error);
+                    if(error) {
+                        return {};
+                    }
+                }
+                std::random_device random {};
+                auto path = directory / ("kstd-streams-spill-" + std::to_string(random()) + std::to_string(random()));
+                std::fstream stream {path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc};
+                if(!stream.is_open()) {
+                    return {};
+                }
+                return SpillFile {std::move(path), std::move(stream), level};
+            }
+
+            auto remove() noexcept -> void {
+                if(_path.empty()) {
+                    return;
+                }
+                _stream.close();
+                std::error_code error {};
+                std::filesystem::remove(_path, error);
+                _path.clear();
+            }
+
+            // A failed write may leave a partial element behind, so only the first get_size() elements can be read back
+            [[nodiscard]] auto write(const T& value) -> bool {
+                SpillCodec<T>::write(_stream, value);
+                if(!_stream) {
+                    return false;
+                }
+                ++_size;
+                return true;
+            }
+
+            // Flushes what was written and seeks back to the first element, also after a failed write
+            [[nodiscard]] auto rewind() -> bool {
+                _stream.clear();
+                _stream.flush();
+                _stream.seekg(0);
+                return !_stream.fail();
+            }
+
+            [[nodiscard]] auto read() -> Option<T> {
+                return SpillCodec<T>::read(_stream);
+            }
+
+            [[nodiscard]] auto get_size() const noexcept -> usize {
+                return _size;
+            }
+
+            [[nodiscard]] auto get_level() const noexcept -> u32 {
+                return _level;
+            }
+        };
+
+        template<typename T>
+        struct DistinctTable final {
+            // clang-format off
+            using KeyType       = T;
+            using EntryType     = T;
+            using ContainerType = std::unordered_set<T>;
+            // clang-format on
+
+            template<typename U>
+            [[nodiscard]] auto make_entry(U&& value) const -> EntryType {
+                return EntryType(std::forward<U>(value));
+            }
+
+            [[nodiscard]] static auto get_key(const EntryType& entry) noexcept -> const KeyType& {
+                return entry;
+            }
+
+            [[nodiscard]] auto merge(ContainerType& container, EntryType& entry) const -> bool {
+                return container.contains(entry);
+            }
+
+            static auto insert(ContainerType& container, EntryType&& entry) -> void {
+                container.insert(std::move(entry));
+            }
+
+            [[nodiscard]] static auto take(ContainerType& container) -> EntryType {
+                return std::move(container.extract(container.begin()).value());
+            }
+        };
+
+        template<typename T, typename KM, typename VM, typename R>
+        struct GroupTable final {
+            // clang-format off
+            using KeyType       = std::decay_t<decltype(invoke_field(std::declval<KM>(), std::declval<T&>()))>;
+            using MappedType    = std::decay_t<decltype(invoke_field(std::declval<VM>(), std::declval<T&>()))>;
+            using EntryType     = std::pair<KeyType, MappedType>;
+            using ContainerType = std::unordered_map<KeyType, MappedType>;
+            // clang-format on
+
+            static_assert(std::is_invocable_r_v<MappedType, R&, MappedType&, MappedType&>,
+                          "Reducer signature does not match");
+
+            KM key_mapper;
+            VM value_mapper;
+            R reducer;
+
+            template<typename U>
+            [[nodiscard]] auto make_entry(U& value) const -> EntryType {
+                return {invoke_field(key_mapper, value), invoke_field(value_mapper, value)};
+            }
+
+            [[nodiscard]] static auto get_key(const EntryType& entry) noexcept -> const KeyType& {
+                return entry.first;
+            }
+
+            [[nodiscard]] auto merge(ContainerType& container, EntryType& entry) -> bool {
+                const auto group = container.find(entry.first);
+                if(group == container.end()) {
+                    return false;
+                }
+                group->second = reducer(group->second, entry.second);
+                return true;
+            }
+
+            static auto insert(ContainerType& container, EntryType&& entry) -> void {
+                container.emplace(std::move(entry));
+            }
+
+            [[nodiscard]] static auto take(ContainerType& container) -> EntryType {
+                auto node = container.extract(container.begin());
+                return {std::move(node.key()), std::move(node.mapped())};
+            }
+        };
+    }// namespace detail
+
+    /**
+     * Pulls all elements of the upstream pipe into a hash table described by TABLE,
+     * then yields the contents of the table. When the table outgrows its memory budget,
+     * it stops growing and every element that can not be merged into it is written to
+     * one of several partition files by its hash instead. Each partition is processed
+     * the same way once the table is drained, so the result does not depend on the budget,
+     * only the order does. If a partition file can not be created or written, that partition
+     * is read back and kept in memory instead, exceeding the budget. Elements which can not
+     * be read back from a partition file are lost, which get_status() reports as failed.
+     */
+    template<typename PIPE, typename TABLE, profiling::StageName NAME = "spilling">
+    struct SpillingPipe final {
+        // clang-format off
+        using PipeType      = PIPE;
+        using TableType     = TABLE;
+        using Self          = SpillingPipe<PipeType, TableType, NAME>;
+        using EntryType     = typename TableType::EntryType;
+        using ContainerType = typename TableType::ContainerType;
+        using FileType      = detail::SpillFile<EntryType>;
+        using CodecType     = detail::SpillCodec<EntryType>;
+        using ValueType     = EntryType;
+        // clang-format on
+
+        static_assert(detail::Spillable<EntryType>,
+                      "Elements of a stage with a memory budget have to be trivially copyable, "
+                      "std::basic_string or std::pair of those to be written to disk");
+
+        static constexpr usize extent = dynamic_extent;
+        // Rough size of one hash table node: the entry, the next pointer, the cached hash and a bucket
+        static constexpr usize node_size = sizeof(typename ContainerType::value_type) + (sizeof(void*) * 3);
+
+        private:
+        PipeType _pipe;
+        TableType _table;
+        MemoryBudget _budget;
+        ContainerType _current;
+        std::vector<FileType> _pending;
+        usize _spilled_partitions;
+        bool _started;
+        bool _has_failed;
+        [[no_unique_address]] profiling::StageProbe<NAME> _probe;
+
+        struct Partitions final {
+            std::array<Option<FileType>, detail::spill_partitions> files {};
+            std::array<bool, detail::spill_partitions> is_in_memory {};
+        };
+
+        auto merge_or_insert(EntryType&& entry) -> void {
+            if(!_table.merge(_current, entry)) {
+                _table.insert(_current, std::move(entry));
+            }
+        }
+
+        // Passes every entry written to the given file to consume, returns false if not all of them could be read
+        template<typename F>
+        [[nodiscard]] static auto read_back(FileType& file, F&& consume) -> bool {
+            if(!file.rewind()) {
+                return false;
+            }
+            for(usize index = 0; index < file.get_size(); ++index) {
+                auto entry = file.read();
+                if(!entry) {
+                    return false;
+                }
+                consume(std::move(*entry));
+            }
+            return true;
+        }
+
+        [[nodiscard]] auto spill(Partitions& partitions, const EntryType& entry, u32 level) -> bool {
+            const auto hash = std::hash<typename TableType::KeyType> {}(TableType::get_key(entry));
+            // Every level of partitioning hashes differently, so a partition does not land in a single partition again
+            const auto index = detail::mix_hash(hash, level) % detail::spill_partitions;
+            if(partitions.is_in_memory[index]) {
+                return false;
+            }
+            auto& partition = partitions.files[index];
+            if(!partition) {
+                partition = FileType::create(_budget, level + 1);
+                if(!partition) {
+                    partitions.is_in_memory[index] = true;
+                    return false;
+                }
+                ++_spilled_partitions;
+            }
+            if(partition->write(entry)) {
+                return true;
+            }
+            // Keep the whole partition in memory from here on, including what already made it into the file
+            partitions.is_in_memory[index] = true;
+            if(!read_back(*partition, [this](EntryType&& spilled) { merge_or_insert(std::move(spilled)); })) {
+                _has_failed = true;
+            }
+            partition = {};
+            --_spilled_partitions;
+            return false;
+        }
+
+        template<typename F>
+        auto fill(F&& next_entry, u32 level) -> void {
+#ifdef KSTD_STREAMS_PROFILING
+            const profiling::TraceSpan span {_probe.get_name(), "spill"};
+#endif
+            Partitions partitions {};
+            usize used_bytes = 0;
+            bool is_full = false;
+            auto entry = next_entry();
+            while(entry) {
+                if(!_table.merge(_current, *entry)) {
+                    const auto size = node_size + CodecType::get_heap_size(*entry);
+                    is_full = is_full || (level < detail::max_spill_depth && size > _budget.max_bytes - used_bytes);
+                    // Once full, the table must not take any new keys, otherwise they could end up in a partition too
+                    if(!is_full || !spill(partitions, *entry, level)) {
+                        _table.insert(_current, std::move(*entry));
+                        used_bytes += size;
+                    }
+                }
+                entry = next_entry();
+            }
+            for(auto& partition : partitions.files) {
+                if(partition) {
+                    _pending.push_back(std::move(*partition));
+                }
+            }
+        }
+
+        auto fill_next() -> bool {
+            if(!_started) {
+                _started = true;
+                fill(
+                        [this]() -> Option<EntryType> {
+                            auto element = _pipe.get_next();
+                            if(!element) {
+                                return {};
+                            }
+                            return _table.make_entry(*element);
+                        },
+                        0);
+                return true;
+            }
+            if(_pending.empty()) {
+                return false;
+            }
+            auto file = std::move(_pending.back());
+            _pending.pop_back();
+            if(!file.rewind()) {
+                _has_failed = true;
+                return true;
+            }
+            usize remaining = file.get_size();
+            fill(
+                    [this, &file, &remaining]() -> Option<EntryType> {
+                        if(remaining == 0) {
+                            return {};
+                        }
+                        auto entry = file.read();
+                        if(!entry) {
+                            _has_failed = true;
+                            remaining = 0;
+                            return {};
+                        }
+                        --remaining;
+                        return entry;
+                    },
+                    file.get_level());
+            return true;
+        }
+
+        public:
+        SpillingPipe(PipeType pipe, TableType table, MemoryBudget budget) noexcept :
+                _pipe {std::move(pipe)},
+                _table {std::move(table)},
+                _budget {budget},
+                _current {},
+                _pending {},
+                _spilled_partitions {0},
+                _started {false},
+                _has_failed {false},
+                _probe {} {
+        }
+
+        SpillingPipe(SpillingPipe&&) noexcept = default;
+        auto operator=(SpillingPipe&&) noexcept -> SpillingPipe& = default;
+        ~SpillingPipe() noexcept = default;
+
+        [[nodiscard]] auto get_size_hint() const noexcept -> usize {
+            // Upstream elements and spilled entries may still share their keys, only the table is distinct
+            return _pending.empty() ? _current.size() : 0;
+        }
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            while(_current.empty()) {
+                if(!fill_next()) {
+                    _probe.leave(scope, false);
+                    return {};
+                }
+            }
+            Option<ValueType> result {TableType::take(_current)};
+            _probe.leave(scope, true);
+            return result;
+        }
+
+        [[nodiscard]] auto get_spilled_partitions() const noexcept -> usize {
+            return _spilled_partitions;
+        }
+
+        [[nodiscard]] auto get_status() const noexcept -> StreamStatus {
+            return detail::get_upstream_status(_pipe).merge({false, _has_failed});
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _pipe.collect_profile(profile);
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            _pipe.describe(plan);
+            std::string details = "hash table";
+            if(_budget.max_bytes != std::numeric_limits<usize>::max()) {
+                details += " limited to " + std::to_string(_budget.max_bytes) + " bytes, spilling into " +
+                           std::to_string(detail::spill_partitions) + " partitions per level";
+            }
+            details += ", " + std::to_string(_spilled_partitions) + " partitions spilled so far, " +
+                       detail::describe_extent(extent);
+            plan.add_stage(_probe.get_name(), std::move(details));
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,63 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <concepts>
+#include <kstd/types.hpp>
+
+#include "abi.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    /**
+     * Whether a stage stopped before yielding everything its upstream would have produced,
+     * either because it was cancelled or because it lost elements to an I/O error.
+     * Stages which can stop early report it through get_status(), and every stage wrapping
+     * one of them forwards it, so the Stream on top can report it for the whole pipeline.
+     */
+    struct StreamStatus final {
+        bool is_cancelled = false;
+        bool has_failed = false;
+
+        [[nodiscard]] constexpr auto merge(const StreamStatus& other) const noexcept -> StreamStatus {
+            return {is_cancelled || other.is_cancelled, has_failed || other.has_failed};
+        }
+    };
+
+    namespace detail {
+        // Streams check their cancellation token once per this many elements
+        static constexpr usize cancellation_check_interval = 1024;
+
+        template<typename PIPE>
+        concept StatusPipe = requires(const PIPE& pipe) {
+            { pipe.get_status() } -> std::same_as<StreamStatus>;
+        };
+
+        template<typename PIPE>
+        [[nodiscard]] constexpr auto get_upstream_status(const PIPE& pipe) noexcept -> StreamStatus {
+            if constexpr(StatusPipe<PIPE>) {
+                return pipe.get_status();
+            }
+            else {
+                return {};
+            }
+        }
+    }// namespace detail
+}// namespace kstd::streams
\ No newline at end of file
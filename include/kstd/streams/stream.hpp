@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+
 /**
  * @author Alexander Hinze
  * @since 16/07/2023
@@ -19,406 +20,23 @@
 
 #pragma once
 
-#include <algorithm>
-#include <kstd/defaults.hpp>
-#include <kstd/option.hpp>
-#include <kstd/pack.hpp>
-#include <unordered_set>
-
-#include "buffered_pipe.hpp"
-#include "iterator_pipe.hpp"
-#include "linked_struct_pipe.hpp"
-#include "pipe.hpp"
-#include "supplier_pipe.hpp"
-
-#include "collectors.hpp"
-#include "comparators.hpp"
-#include "filters.hpp"
-#include "mappers.hpp"
-#include "reducers.hpp"
-
-#define KSTD_PTR_FIELD_FUNCTOR(n)                                                                                      \
-    [](auto* value) noexcept -> auto {                                                                                 \
-        return value->n;                                                                                               \
-    }
-
-#define KSTD_FIELD_FUNCTOR(n)                                                                                          \
-    [](auto& value) noexcept -> auto {                                                                                 \
-        return value.n;                                                                                                \
-    }
-
-#define KSTD_CONSTANT_FUNCTOR(x)                                                                                       \
-    [](auto& value) noexcept -> auto {                                                                                 \
-        return x;                                                                                                      \
-    }
-
-#define KSTD_RCAST_FIELD_FUNCTOR(n, t)                                                                                 \
-    [](auto& value) noexcept -> auto {                                                                                 \
-        return reinterpret_cast<t>(value.n);                                                                           \
-    }
-
-#define KSTD_SCAST_FIELD_FUNCTOR(n, t)                                                                                 \
-    [](auto& value) noexcept -> auto {                                                                                 \
-        return static_cast<t>(value.n);                                                                                \
-    }
-
-#define KSTD_RCAST_PTR_FIELD_FUNCTOR(n, t)                                                                             \
-    [](auto* value) noexcept -> auto {                                                                                 \
-        return reinterpret_cast<t>(value->n);                                                                          \
-    }
-
-#define KSTD_SCAST_PTR_FIELD_FUNCTOR(n, t)                                                                             \
-    [](auto* value) noexcept -> auto {                                                                                 \
-        return static_cast<t>(value->n);                                                                               \
-    }
-
-namespace kstd::streams {
-    template<typename PIPE>
-    struct Stream final {
-        // clang-format off
-        using PipeType          = PIPE;
-        using ValueType         = typename PipeType::ValueType;
-        using NakedValueType    = std::remove_cv_t<std::remove_reference_t<ValueType>>;
-        using Self              = Stream<PipeType>;
-        // clang-format on
-
-        private:
-        PipeType _pipe;
-
-        template<typename F>
-        [[nodiscard]] constexpr auto make_filter_sleeve(F predicate) noexcept -> decltype(auto) {
-            return [predicate = std::move(predicate)](PipeType& pipe) noexcept -> Option<ValueType> {
-                auto element = pipe.get_next();
-                while(element && !predicate(*element)) {
-                    element = pipe.get_next();
-                }
-                return element;
-            };
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto make_map_sleeve(F mapper) noexcept -> decltype(auto) {
-            return [mapper = std::move(mapper)](PipeType& pipe) noexcept -> Option<std::invoke_result_t<F, ValueType>> {
-                auto element = pipe.get_next();
-                if(!element) {
-                    return {};
-                }
-                return mapper(*element);
-            };
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto make_peek_sleeve(F function) noexcept -> decltype(auto) {
-            return [function = std::move(function)](PipeType& pipe) noexcept -> Option<ValueType> {
-                auto element = pipe.get_next();
-                if(!element) {
-                    return {};
-                }
-                function(*element);
-                return element;
-            };
-        }
-
-        [[nodiscard]] constexpr auto make_sort_callback() noexcept -> decltype(auto) {
-            return [](auto& buffer) noexcept -> void {
-                std::sort(buffer.begin(), buffer.end());
-            };
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto make_sort_callback(F comparator) noexcept -> decltype(auto) {// NOLINT
-            return [comparator = std::move(comparator)](auto& buffer) noexcept -> void {
-                std::sort(buffer.begin(), buffer.end(), std::move(comparator));
-            };
-        }
-
-        [[nodiscard]] constexpr auto make_reverse_sort_callback() noexcept -> decltype(auto) {
-            return [](auto& buffer) noexcept -> void {
-                std::sort(buffer.rbegin(), buffer.rend());
-            };
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto make_reverse_sort_callback(F comparator) noexcept -> decltype(auto) {// NOLINT
-            return [comparator = std::move(comparator)](auto& buffer) noexcept -> void {
-                std::sort(buffer.rbegin(), buffer.rend(), std::move(comparator));
-            };
-        }
-
-        [[nodiscard]] constexpr auto make_distinct_callback() noexcept -> decltype(auto) {
-            return [](auto& buffer) noexcept -> void {
-                using Buffer = std::remove_reference_t<decltype(buffer)>;
-                using Type = std::decay_t<typename Buffer::value_type>;
-                const std::unordered_set<Type> elements {buffer.cbegin(), buffer.cend()};
-                buffer = {elements.cbegin(), elements.cend()};
-            };
-        }
-
-        public:
-        KSTD_NO_MOVE_COPY(Stream, Self, constexpr)// Streams are temporary only
-
-        explicit constexpr Stream(PipeType pipe) noexcept :
-                _pipe {std::move(pipe)} {
-        }
-
-        ~Stream() noexcept = default;
-
-        template<typename F>
-        [[nodiscard]] constexpr auto map(F mapper) noexcept
-                -> Stream<Pipe<PipeType, decltype(make_map_sleeve(std::move(mapper)))>> {
-            auto sleeve = make_map_sleeve(std::move(mapper));
-            using Pipe = Pipe<PipeType, decltype(sleeve)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(sleeve)}};
-        }
-
-        [[nodiscard]] constexpr auto deref_all() noexcept -> decltype(auto) {
-            return map(mappers::dereference);
-        }
-
-        [[nodiscard]] constexpr auto address_of_all() noexcept -> decltype(auto) {
-            return map(mappers::address_of);
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto filter(F predicate) noexcept
-                -> Stream<Pipe<PipeType, decltype(make_filter_sleeve(std::move(predicate)))>> {
-            static_assert(std::is_convertible_v<F, std::function<bool(ValueType)>>,
-                          "Predicate signature does not match");
-            auto sleeve = make_filter_sleeve(std::move(predicate));
-            using Pipe = Pipe<PipeType, decltype(sleeve)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(sleeve)}};
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto peek(F function) noexcept
-                -> Stream<Pipe<PipeType, decltype(make_peek_sleeve(std::move(function)))>> {
-            static_assert(std::is_convertible_v<F, std::function<void(ValueType)>>,
-                          "Function signature does not match");
-            auto sleeve = make_peek_sleeve(std::move(function));
-            using Pipe = Pipe<PipeType, decltype(sleeve)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(sleeve)}};
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto peek_all(F function) noexcept -> Stream<BufferedPipe<PipeType, F>> {
-            using Pipe = BufferedPipe<PipeType, F>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(function)}};
-        }
-
-        template<typename F>
-        constexpr auto for_each(F&& function) noexcept -> void {
-            auto element = _pipe.get_next();
-            while(element) {
-                function(*element);
-                element = _pipe.get_next();
-            }
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto reduce(F function, NakedValueType value = NakedValueType {}) noexcept
-                -> NakedValueType {
-            auto element = _pipe.get_next();
-            while(element) {
-                value = function(value, *element);
-                element = _pipe.get_next();
-            }
-            return value;
-        }
-
-        [[nodiscard]] constexpr auto distinct() noexcept
-                -> Stream<BufferedPipe<PipeType, decltype(make_distinct_callback())>> {
-            auto callback = make_distinct_callback();
-            using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
-        }
-
-        [[nodiscard]] constexpr auto distinct_by_address() noexcept -> decltype(auto) {
-            return map(mappers::address_of).distinct().map(mappers::dereference);
-        }
-
-        [[nodiscard]] constexpr auto distinct_by_value() noexcept -> decltype(auto) {
-            return map(mappers::dereference).distinct().map(mappers::address_of);
-        }
-
-        [[nodiscard]] constexpr auto sum() noexcept -> decltype(auto) {
-            return reduce(reducers::add);
-        }
-
-        [[nodiscard]] constexpr auto count() noexcept -> usize {
-            usize count = 0;
-            auto element = _pipe.get_next();
-            while(element) {
-                ++count;
-                element = _pipe.get_next();
-            }
-            return count;
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto index_of(F predicate) noexcept -> usize {
-            usize index = 0;
-            auto element = _pipe.get_next();
-            while(element && !predicate(*element)) {
-                ++index;
-                element = _pipe.get_next();
-            }
-            return index;
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto index_of_last(F predicate) noexcept -> usize {
-            usize index = 0;
-            usize result = 0;
-            auto element = _pipe.get_next();
-            while(element) {
-                ++index;
-                if(predicate(*element)) {
-                    result = index;
-                }
-                element = _pipe.get_next();
-            }
-            return result;
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto find_first(F predicate) noexcept -> Option<ValueType> {
-            auto element = _pipe.get_next();
-            while(element && !predicate(*element)) {
-                element = _pipe.get_next();
-            }
-            return element;
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto find_last(F predicate) noexcept -> Option<ValueType> {
-            auto element = _pipe.get_next();
-            Option<ValueType> result {};
-            while(element) {
-                if(predicate(*element)) {
-                    result = std::move(element);
-                }
-                element = _pipe.get_next();
-            }
-            return result;
-        }
-
-        [[nodiscard]] constexpr auto find_any() noexcept -> Option<ValueType> {
-            return _pipe.get_next();
-        }
-
-        [[nodiscard]] constexpr auto sort() noexcept -> Stream<BufferedPipe<PipeType, decltype(make_sort_callback())>> {
-            auto callback = make_sort_callback();
-            using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto sort(F comparator) noexcept
-                -> Stream<BufferedPipe<PipeType, decltype(make_sort_callback(std::move(comparator)))>> {
-            auto callback = make_sort_callback(std::move(comparator));
-            using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
-        }
-
-        [[nodiscard]] constexpr auto reverse_sort() noexcept
-                -> Stream<BufferedPipe<PipeType, decltype(make_reverse_sort_callback())>> {
-            auto callback = make_reverse_sort_callback();
-            using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
-        }
-
-        template<typename F>
-        [[nodiscard]] constexpr auto reverse_sort(F comparator) noexcept
-                -> Stream<BufferedPipe<PipeType, decltype(make_reverse_sort_callback(std::move(comparator)))>> {
-            auto callback = make_reverse_sort_callback(std::move(comparator));
-            using Pipe = BufferedPipe<PipeType, decltype(callback)>;
-            return Stream<Pipe> {Pipe {std::move(_pipe), std::move(callback)}};
-        }
-
-        template<template<typename, typename...> typename CONTAINER, typename... PROPS, typename COLLECTOR,
-                 typename... ARGS>
-        [[nodiscard]] constexpr auto collect(COLLECTOR collector, ARGS&&... args) noexcept
-                -> CONTAINER<std::remove_cv_t<std::remove_reference_t<ValueType>>, PROPS...> {
-            CONTAINER<std::remove_cv_t<std::remove_reference_t<ValueType>>, PROPS...> result {
-                    std::forward<ARGS>(args)...};
-            collector(_pipe, result);
-            return result;
-        }
-
-        template<template<typename, typename...> typename CONTAINER, typename... PROPS, typename COLLECTOR>
-        constexpr auto
-        collect_into(CONTAINER<std::remove_cv_t<std::remove_reference_t<ValueType>>, PROPS...>& container,
-                     COLLECTOR collector) noexcept -> void {
-            collector(_pipe, container);
-        }
-
-        template<template<typename, typename, typename...> typename MAP, typename... PROPS, typename KM, typename VM,
-                 typename... ARGS>
-        [[nodiscard]] constexpr auto collect_map(KM key_mapper, VM value_mapper, ARGS&&... args) noexcept
-                -> MAP<std::invoke_result_t<KM, ValueType&>, std::invoke_result_t<VM, ValueType&>, PROPS...> {
-            MAP<std::invoke_result_t<KM, ValueType&>, std::invoke_result_t<VM, ValueType&>, PROPS...> result {
-                    std::forward<ARGS>(args)...};
-            auto element = _pipe.get_next();
-            while(element) {
-                auto& value = *element;
-                result[key_mapper(value)] = value_mapper(value);
-                element = _pipe.get_next();
-            }
-            return result;
-        }
-
-        template<template<typename, typename, typename...> typename MAP, typename... PROPS, typename KM, typename VM>
-        constexpr auto
-        collect_map_into(MAP<std::invoke_result_t<KM, ValueType&>, std::invoke_result_t<VM, ValueType&>, PROPS...>& map,
-                         KM key_mapper, VM value_mapper) noexcept -> void {
-            auto element = _pipe.get_next();
-            while(element) {
-                auto& value = *element;
-                map[key_mapper(value)] = value_mapper(value);
-                element = _pipe.get_next();
-            }
-        }
-    };
-
-    template<typename ITERATOR>
-    [[nodiscard]] constexpr auto stream(ITERATOR begin, ITERATOR end) noexcept -> Stream<IteratorPipe<ITERATOR>> {
-        using Pipe = IteratorPipe<ITERATOR>;
-        return Stream<Pipe> {Pipe {begin, end}};
-    }
-
-    template<typename CONTAINER>
-    [[nodiscard]] constexpr auto stream(CONTAINER& container) noexcept
-            -> Stream<IteratorPipe<typename CONTAINER::iterator>> {
-        return stream<typename CONTAINER::iterator>(container.begin(), container.end());
-    }
-
-    template<typename CONTAINER>
-    [[nodiscard]] constexpr auto stream(const CONTAINER& container) noexcept
-            -> Stream<IteratorPipe<typename CONTAINER::const_iterator>> {
-        return stream<typename CONTAINER::const_iterator>(container.cbegin(), container.cend());
-    }
-
-    template<typename SUPPLIER>
-    [[nodiscard]] constexpr auto stream_until_empty(SUPPLIER supplier) noexcept -> Stream<SupplierPipe<SUPPLIER>> {
-        using Pipe = SupplierPipe<SUPPLIER>;
-        return Stream<Pipe> {Pipe {std::move(supplier)}};
-    }
-
-    template<typename A, typename F>
-    [[nodiscard]] constexpr auto stream_until_null(A address, F functor) noexcept -> Stream<LinkedStructPipe<A, F>> {
-        using Pipe = LinkedStructPipe<A, F>;
-        return Stream<Pipe> {Pipe {address, std::move(functor)}};
-    }
-
-    template<typename CONTAINER>
-    [[nodiscard]] constexpr auto reverse_stream(CONTAINER& container) noexcept
-            -> Stream<IteratorPipe<typename CONTAINER::reverse_iterator>> {
-        return stream<typename CONTAINER::reverse_iterator>(container.rbegin(), container.rend());
-    }
+/*
+ * Includes streams with their everyday operations, that is core.hpp, buffering.hpp and format.hpp.
+ * Opt-in stages with heavier dependencies have headers of their own, which include core.hpp:
+ *  - core.hpp: streams, sources and all operations not listed below
+ *  - buffering.hpp: sort, reverse_sort and distinct, which need <algorithm> and <unordered_set>
+ *  - format.hpp: mappers::format, which needs fmt
+ *  - cancellable_pipe.hpp: with_cancellation, sort with a CancellationToken and cancellable
+ *    stream_until_empty, which need <chrono> and <stop_token>
+ *  - batch_pipe.hpp: batch and stream_until_empty_timed, which need <atomic> and <chrono>
+ *  - window_pipe.hpp: sliding_window_aggregate, tumbling_window and stream_until_empty_timed, which need <chrono>
+ *  - resumable_task.hpp: resumable, which needs <chrono>
+ *  - parallel.hpp: parallel execution of pipelines over random access ranges, which needs <thread>
+ *  - spilling.hpp: distinct and group_by with a memory budget, which need <filesystem> and <fstream>
+ *  - materialized_view.hpp: incrementally maintained pipeline results and their aggregators
+ *  - sketches.hpp: top_frequent and frequency_sketch, which need <unordered_map>
+ */
 
-    template<typename CONTAINER>
-    [[nodiscard]] constexpr auto reverse_stream(const CONTAINER& container) noexcept
-            -> Stream<IteratorPipe<typename CONTAINER::const_reverse_iterator>> {
-        return stream<typename CONTAINER::const_reverse_iterator>(container.crbegin(), container.crend());
-    }
-}// namespace kstd::streams
\ No newline at end of file
+#include "buffering.hpp"
+#include "core.hpp"
+#include "format.hpp"
\ No newline at end of file
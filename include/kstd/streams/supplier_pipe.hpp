@@ -21,9 +21,14 @@
 
 #include <kstd/defaults.hpp>
 #include <kstd/option.hpp>
+#include <kstd/types.hpp>
 #include <type_traits>
 
-namespace kstd::streams {
+#include "abi.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
     template<typename SUPPLIER>
     struct SupplierPipe final {
         // clang-format off
@@ -34,22 +39,44 @@ namespace kstd::streams {
 
         private:
         SupplierType _supplier;
+        [[no_unique_address]] profiling::StageProbe<"supplier"> _probe;
+
+        [[nodiscard]] constexpr auto read_next() noexcept -> Option<ValueType> {
+            return _supplier();
+        }
 
         public:
         KSTD_DEFAULT_MOVE_COPY(SupplierPipe, Self, constexpr)
 
         constexpr SupplierPipe() noexcept :
-                _supplier {} {
+                _supplier {},
+                _probe {} {
         }
 
         explicit constexpr SupplierPipe(SupplierType supplier) noexcept :
-                _supplier(std::move(supplier)) {
+                _supplier(std::move(supplier)),
+                _probe {} {
         }
 
         ~SupplierPipe() noexcept = default;
 
+        [[nodiscard]] constexpr auto get_size_hint() const noexcept -> usize {
+            return 0;
+        }
+
         [[nodiscard]] constexpr auto get_next() noexcept -> Option<ValueType> {
-            return _supplier();
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            plan.add_stage(_probe.get_name(), "size unknown, dynamic extent, not splittable");
         }
     };
 }// namespace kstd::streams
\ No newline at end of file
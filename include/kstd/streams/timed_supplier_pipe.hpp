@@ -0,0 +1,99 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <type_traits>
+#include <utility>
+
+#include "abi.hpp"
+#include "extent.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    namespace detail {
+        // Sources which can wait for their next element until a deadline, see TimedSupplierPipe
+        template<typename PIPE>
+        concept TimedPipe = requires(PIPE& pipe, std::chrono::steady_clock::time_point deadline) {
+            { pipe.get_next_until(deadline) } -> std::same_as<Option<typename PIPE::ValueType>>;
+        };
+    }// namespace detail
+
+    /**
+     * A source like SupplierPipe, but its supplier takes the deadline until which it may wait
+     * for the next element, and returns an empty Option if none arrived by then. An empty Option
+     * before the deadline ends the stream. The deadline is the one of the pending batch (see BatchPipe)
+     * or the end of the open time window (see TumblingWindowPipe), and time_point::max() without either.
+     */
+    template<typename SUPPLIER>
+    struct TimedSupplierPipe final {
+        // clang-format off
+        using SupplierType  = SUPPLIER;
+        using Self          = TimedSupplierPipe<SupplierType>;
+        using Clock         = std::chrono::steady_clock;
+        using ValueType     = typename std::invoke_result_t<SupplierType&, Clock::time_point>::value_type;
+        // clang-format on
+
+        static constexpr usize extent = dynamic_extent;
+
+        private:
+        SupplierType _supplier;
+        [[no_unique_address]] profiling::StageProbe<"timed_supplier"> _probe;
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(TimedSupplierPipe, Self)
+
+        explicit TimedSupplierPipe(SupplierType supplier) noexcept :
+                _supplier(std::move(supplier)),
+                _probe {} {
+        }
+
+        ~TimedSupplierPipe() noexcept = default;
+
+        [[nodiscard]] auto get_size_hint() const noexcept -> usize {
+            return 0;
+        }
+
+        [[nodiscard]] auto get_next_until(Clock::time_point deadline) noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = _supplier(deadline);
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            return get_next_until(Clock::time_point::max());
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            plan.add_stage(_probe.get_name(), "waits until a deadline, size unknown, dynamic extent, not splittable");
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
@@ -0,0 +1,336 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <mutex>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "abi.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI::profiling {
+    struct TraceEvent final {
+        const char* name;
+        const char* category;
+        u64 begin;   // Nanoseconds since the recorder was created
+        u64 duration;// Nanoseconds, always 0 for instant events
+        u32 thread;
+        bool is_instant;
+    };
+
+    struct TraceSpan;
+
+    /**
+     * Records timeline events of every thread running stream work and exports them
+     * in the Chrome trace event format, which chrome://tracing and Perfetto can open.
+     *
+     * Each thread appends to its own buffer without synchronization; the mutex is only taken
+     * when a thread records into another recorder than the one it last recorded into, to find
+     * or create its buffer in this one. Events may only be read or exported
+     * once all recording threads are done. A recorder has to outlive every TraceSpan
+     * begun on it, unless it stops being the active one (see set_active) before it is destroyed.
+     */
+    struct TraceRecorder final {
+        private:
+        friend struct TraceSpan;
+
+        struct ThreadBuffer final {
+            u32 thread;
+            usize reserved;// Room kept in events for the spans still open on this thread
+            std::vector<TraceEvent> events;
+        };
+
+        // Every recorder which has not been destroyed yet, linked through the recorders themselves
+        struct LiveRecorders final {
+            std::mutex mutex;
+            TraceRecorder* head;
+        };
+
+        u64 _id;
+        std::chrono::steady_clock::time_point _start;
+        std::mutex _mutex;
+        std::deque<ThreadBuffer> _buffers;
+        TraceRecorder* _previous_live;
+        TraceRecorder* _next_live;
+
+        [[nodiscard]] static auto get_live_recorders() noexcept -> LiveRecorders& {
+            static LiveRecorders recorders {{}, nullptr};
+            return recorders;
+        }
+
+        [[nodiscard]] static auto get_active_recorder() noexcept -> std::atomic<TraceRecorder*>& {
+            static std::atomic<TraceRecorder*> recorder {nullptr};
+            return recorder;
+        }
+
+        [[nodiscard]] static auto next_id() noexcept -> u64 {
+            static std::atomic<u64> id {1};
+            return id.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static auto get_thread_id() noexcept -> u32 {
+            static std::atomic<u32> next_id {0};
+            thread_local const u32 id = next_id.fetch_add(1, std::memory_order_relaxed);
+            return id;
+        }
+
+        [[nodiscard]] auto get_thread_buffer() -> ThreadBuffer& {
+            // Recorder ids are never reused, so a stale cache entry can not alias a new recorder
+            thread_local u64 cached_id = 0;
+            thread_local ThreadBuffer* cached_buffer = nullptr;
+            if(cached_id != _id) {
+                // A thread switching between recorders keeps its one buffer in each of them
+                const auto thread = get_thread_id();
+                const std::lock_guard lock {_mutex};
+                const auto buffer = std::find_if(_buffers.begin(), _buffers.end(), [thread](const auto& buffer) {
+                    return buffer.thread == thread;
+                });
+                cached_buffer = buffer != _buffers.end() ? &*buffer
+                                                         : &_buffers.emplace_back(ThreadBuffer {thread, 0, {}});
+                cached_id = _id;
+            }
+            return *cached_buffer;
+        }
+
+        // Makes room for count events besides the ones reserved for open spans
+        static auto reserve(ThreadBuffer& buffer, usize count) -> void {
+            const auto size = buffer.events.size() + buffer.reserved + count;
+            if(buffer.events.capacity() < size) {
+                buffer.events.reserve(std::max(buffer.events.capacity() << 1, size));
+            }
+        }
+
+        // Gives back the room of a span which was dropped, unless its recorder has been destroyed since
+        static auto release_span(u64 id, ThreadBuffer& buffer) noexcept -> void {
+            auto& live = get_live_recorders();
+            const std::lock_guard lock {live.mutex};
+            for(const auto* recorder = live.head; recorder != nullptr; recorder = recorder->_next_live) {
+                if(recorder->_id == id) {
+                    --buffer.reserved;
+                    return;
+                }
+            }
+        }
+
+        static auto write_escaped(std::ostream& stream, const char* value) -> void {
+            for(; *value != '\0'; ++value) {
+                if(*value == '"' || *value == '\\') {
+                    stream << '\\';
+                }
+                stream << *value;
+            }
+        }
+
+        public:
+        KSTD_NO_MOVE_COPY(TraceRecorder, TraceRecorder)
+
+        TraceRecorder() noexcept :
+                _id {next_id()},
+                _start {std::chrono::steady_clock::now()},
+                _mutex {},
+                _buffers {},
+                _previous_live {nullptr},
+                _next_live {nullptr} {
+            auto& live = get_live_recorders();
+            const std::lock_guard lock {live.mutex};
+            _next_live = live.head;
+            if(_next_live != nullptr) {
+                _next_live->_previous_live = this;
+            }
+            live.head = this;
+        }
+
+        ~TraceRecorder() noexcept {
+            auto* self = this;
+            get_active_recorder().compare_exchange_strong(self, nullptr);
+            auto& live = get_live_recorders();
+            const std::lock_guard lock {live.mutex};
+            (_previous_live != nullptr ? _previous_live->_next_live : live.head) = _next_live;
+            if(_next_live != nullptr) {
+                _next_live->_previous_live = _previous_live;
+            }
+        }
+
+        /**
+         * Makes the given recorder, or none when passing nullptr, receive the
+         * spans emitted by kstd-streams itself and by TraceSpan.
+         */
+        static auto set_active(TraceRecorder* recorder) noexcept -> void {
+            get_active_recorder().store(recorder, std::memory_order_release);
+        }
+
+        [[nodiscard]] static auto get_active() noexcept -> TraceRecorder* {
+            return get_active_recorder().load(std::memory_order_acquire);
+        }
+
+        // The number of spans begun on this recorder which have not ended yet, see TraceSpan
+        [[nodiscard]] auto get_open_spans() const noexcept -> usize {
+            usize spans = 0;
+            for(const auto& buffer : _buffers) {
+                spans += buffer.reserved;
+            }
+            return spans;
+        }
+
+        [[nodiscard]] auto get_elapsed() const noexcept -> u64 {
+            const auto elapsed = std::chrono::steady_clock::now() - _start;
+            return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+        auto record_span(const char* name, const char* category, u64 begin) -> void {
+            auto& buffer = get_thread_buffer();
+            reserve(buffer, 1);
+            buffer.events.push_back({name, category, begin, get_elapsed() - begin, buffer.thread, false});
+        }
+
+        auto record_instant(const char* name, const char* category) -> void {
+            auto& buffer = get_thread_buffer();
+            reserve(buffer, 1);
+            buffer.events.push_back({name, category, get_elapsed(), 0, buffer.thread, true});
+        }
+
+        [[nodiscard]] auto get_events() const -> std::vector<TraceEvent> {
+            std::vector<TraceEvent> events {};
+            for(const auto& buffer : _buffers) {
+                events.insert(events.end(), buffer.events.begin(), buffer.events.end());
+            }
+            std::stable_sort(events.begin(), events.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.begin < rhs.begin;
+            });
+            return events;
+        }
+
+        auto write_chrome_trace(std::ostream& stream) const -> void {
+            const auto events = get_events();
+            stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+            for(usize index = 0; index < events.size(); ++index) {
+                const auto& event = events[index];
+                stream << (index == 0 ? "" : ",") << "{\"name\":\"";
+                write_escaped(stream, event.name);
+                stream << "\",\"cat\":\"";
+                write_escaped(stream, event.category);
+                // Chrome traces are in microseconds, fractions keep the nanosecond resolution
+                stream << "\",\"ph\":\"" << (event.is_instant ? "i" : "X") << "\",\"ts\":" << event.begin / 1000
+                       << '.' << (event.begin % 1000) / 100 << (event.begin % 100) / 10 << event.begin % 10;
+                if(event.is_instant) {
+                    stream << ",\"s\":\"t\"";
+                }
+                else {
+                    stream << ",\"dur\":" << event.duration / 1000 << '.' << (event.duration % 1000) / 100
+                           << (event.duration % 100) / 10 << event.duration % 10;
+                }
+                stream << ",\"pid\":1,\"tid\":" << event.thread << '}';
+            }
+            stream << "]}";
+        }
+
+        [[nodiscard]] auto save_chrome_trace(const std::filesystem::path& path) const -> bool {
+            std::ofstream stream {path};
+            if(!stream) {
+                return false;
+            }
+            write_chrome_trace(stream);
+            return static_cast<bool>(stream);
+        }
+    };
+
+    /**
+     * Records the time between its construction and destruction as a span
+     * on the active recorder, if there is one. The room for the event is made when
+     * the span begins, so ending it never allocates. A span is dropped if its recorder
+     * is no longer the active one when it ends, which gives that room back if the recorder still exists.
+     */
+    struct TraceSpan final {
+        private:
+        TraceRecorder* _recorder;
+        u64 _recorder_id;
+        TraceRecorder::ThreadBuffer* _buffer;
+        const char* _name;
+        const char* _category;
+        u64 _begin;
+
+        public:
+        KSTD_NO_MOVE_COPY(TraceSpan, TraceSpan)
+
+        constexpr explicit TraceSpan(const char* name, const char* category = "stream") :
+                _recorder {nullptr},
+                _recorder_id {0},
+                _buffer {nullptr},
+                _name {name},
+                _category {category},
+                _begin {0} {
+            if(!std::is_constant_evaluated()) {
+                _recorder = TraceRecorder::get_active();
+                if(_recorder != nullptr) {
+                    _recorder_id = _recorder->_id;
+                    _buffer = &_recorder->get_thread_buffer();
+                    TraceRecorder::reserve(*_buffer, 1);
+                    ++_buffer->reserved;
+                    _begin = _recorder->get_elapsed();
+                }
+            }
+        }
+
+        constexpr ~TraceSpan() noexcept {
+            if(std::is_constant_evaluated() || _recorder == nullptr) {
+                return;
+            }
+            // Recorder ids are never reused, so this also catches a new recorder at the same address
+            const auto* active = TraceRecorder::get_active();
+            if(active != _recorder || active->_id != _recorder_id) {
+                TraceRecorder::release_span(_recorder_id, *_buffer);
+                return;
+            }
+            --_buffer->reserved;
+            _buffer->events.push_back({_name, _category, _begin, _recorder->get_elapsed() - _begin,
+                                       _buffer->thread, false});
+        }
+    };
+
+    /**
+     * Records a zero-length event on the active recorder, if there is one.
+     */
+    inline auto trace_instant(const char* name, const char* category = "stream") -> void {
+        if(auto* recorder = TraceRecorder::get_active()) {
+            recorder->record_instant(name, category);
+        }
+    }
+
+    /**
+     * Invokes the given function, usually a terminal operation or one chunk of
+     * work on a worker thread, inside a span with the given name.
+     */
+    template<typename F>
+    auto trace(const char* name, F&& function) -> std::invoke_result_t<F> {
+        const TraceSpan span {name};
+        return std::forward<F>(function)();
+    }
+}// namespace kstd::streams::profiling
\ No newline at end of file
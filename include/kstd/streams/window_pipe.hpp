@@ -0,0 +1,326 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <kstd/defaults.hpp>
+#include <kstd/option.hpp>
+#include <kstd/types.hpp>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "abi.hpp"
+#include "aggregators.hpp"
+#include "core.hpp"
+#include "extent.hpp"
+#include "plan.hpp"
+#include "profiler.hpp"
+#include "status.hpp"
+#include "timed_supplier_pipe.hpp"
+
+namespace kstd::streams::inline KSTD_STREAMS_ABI {
+    namespace detail {
+        template<typename AGGREGATOR, typename STATE>
+        [[nodiscard]] constexpr auto get_aggregate_result(const AGGREGATOR& aggregator, const STATE& state) noexcept
+                -> decltype(auto) {
+            if constexpr(requires { aggregator.get_result(state); }) {
+                return aggregator.get_result(state);
+            }
+            else {
+                return STATE {state};
+            }
+        }
+
+        template<typename AGGREGATOR, typename T>
+        using AggregateStateType = decltype(std::declval<const AGGREGATOR&>().template make_state<T>());
+
+        template<typename DURATION>
+        struct PeriodKeyMapper final {
+            using Clock = std::chrono::steady_clock;
+
+            Clock::duration length;
+            Clock::time_point start;
+
+            explicit PeriodKeyMapper(DURATION length) noexcept :
+                    length {std::chrono::duration_cast<Clock::duration>(length)},
+                    start {Clock::now()} {
+            }
+
+            template<typename T>
+            [[nodiscard]] auto operator()(T&) const noexcept -> usize {
+                return static_cast<usize>((Clock::now() - start) / length);
+            }
+
+            // The point in time at which the period with the given index ends
+            [[nodiscard]] auto get_deadline(usize period) const noexcept -> Clock::time_point {
+                return start + length * static_cast<Clock::rep>(period + 1);
+            }
+        };
+
+        // Key mappers whose windows end at a known point in time, like PeriodKeyMapper
+        template<typename KM, typename KEY>
+        concept DeadlineKeyMapper = requires(const KM& key_mapper, const KEY& key) {
+            { key_mapper.get_deadline(key) } -> std::same_as<std::chrono::steady_clock::time_point>;
+        };
+
+        template<typename AGGREGATOR, typename T>
+        using AggregateResultType = std::decay_t<decltype(get_aggregate_result(
+                std::declval<const AGGREGATOR&>(), std::declval<const AggregateStateType<AGGREGATOR, T>&>()))>;
+    }// namespace detail
+
+    /**
+     * Yields the aggregate of the last window_size elements for every element, starting
+     * with the first element which fills the window. Instead of aggregating the whole window
+     * again, the aggregator (see aggregators.hpp) removes the element leaving the window and
+     * adds the one entering it, so every element costs (amortized) constant time.
+     */
+    template<typename PIPE, typename AGGREGATOR>
+    struct SlidingWindowPipe final {
+        // clang-format off
+        using PipeType          = PIPE;
+        using AggregatorType    = AGGREGATOR;
+        using Self              = SlidingWindowPipe<PipeType, AggregatorType>;
+        using ElementType       = std::remove_cv_t<std::remove_reference_t<typename PipeType::ValueType>>;
+        using StateType         = detail::AggregateStateType<AggregatorType, ElementType>;
+        using ValueType         = detail::AggregateResultType<AggregatorType, ElementType>;
+        // clang-format on
+
+        static_assert(aggregators::HasCheapResult<AggregatorType, ElementType>,
+                      "Aggregator state would be copied for every element, which only works for tumbling windows");
+
+        static constexpr usize extent = dynamic_extent;
+
+        private:
+        PipeType _pipe;
+        AggregatorType _aggregator;
+        StateType _state;
+        std::vector<ElementType> _window;// Ring buffer of the elements in the window once it is full
+        usize _window_size;
+        usize _oldest;
+        [[no_unique_address]] profiling::StageProbe<"sliding_window_aggregate"> _probe;
+
+        [[nodiscard]] auto read_next() noexcept -> Option<ValueType> {
+            auto element = _pipe.get_next();
+            while(element) {
+                ElementType value = *element;
+                if(_window.size() < _window_size) {
+                    _aggregator.add(_state, value);
+                    _window.push_back(std::move(value));
+                    if(_window.size() == _window_size) {
+                        return detail::get_aggregate_result(_aggregator, _state);
+                    }
+                    element = _pipe.get_next();
+                    continue;
+                }
+                _aggregator.remove(_state, _window[_oldest]);
+                _aggregator.add(_state, value);
+                _window[_oldest] = std::move(value);
+                _oldest = (_oldest + 1) % _window_size;
+                return detail::get_aggregate_result(_aggregator, _state);
+            }
+            return {};
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(SlidingWindowPipe, Self)
+
+        SlidingWindowPipe(PipeType pipe, usize window_size, AggregatorType aggregator) noexcept :
+                _pipe {std::move(pipe)},
+                _aggregator {std::move(aggregator)},
+                _state {_aggregator.template make_state<ElementType>()},
+                _window {},
+                _window_size {window_size == 0 ? 1 : window_size},
+                _oldest {0},
+                _probe {} {
+            _window.reserve(_window_size);
+        }
+
+        ~SlidingWindowPipe() noexcept = default;
+
+        [[nodiscard]] auto get_size_hint() const noexcept -> usize {
+            // There is one aggregate per element once the window is full
+            const auto hint = _pipe.get_size_hint();
+            if(hint == 0 || _window.size() == _window_size) {
+                return hint;
+            }
+            const auto size = hint + _window.size();
+            return size < _window_size ? 0 : size - _window_size + 1;
+        }
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        [[nodiscard]] auto get_status() const noexcept -> StreamStatus
+            requires(detail::StatusPipe<PipeType>)
+        {
+            return _pipe.get_status();
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _pipe.collect_profile(profile);
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            _pipe.describe(plan);
+            plan.add_stage(_probe.get_name(), "window of " + std::to_string(_window_size) +
+                                                      " elements in a ring buffer, updated incrementally, " +
+                                                      detail::describe_extent(extent));
+        }
+    };
+
+    /**
+     * Yields one pair of window key and aggregate per run of consecutive elements with the
+     * same key, so elements have to arrive ordered or grouped by their window, like metrics
+     * bucketed by their timestamp. A window ends as soon as an element of the next one arrives.
+     * Time based windows over a TimedSupplierPipe are also closed at the end of their period,
+     * as the source is only waited on until then, so they are emitted on time while no elements
+     * arrive. Any other source is only checked whenever it yields an element.
+     */
+    template<typename PIPE, typename KM, typename AGGREGATOR>
+    struct TumblingWindowPipe final {
+        // clang-format off
+        using PipeType          = PIPE;
+        using KeyMapperType     = KM;
+        using AggregatorType    = AGGREGATOR;
+        using Self              = TumblingWindowPipe<PipeType, KeyMapperType, AggregatorType>;
+        using ElementType       = std::remove_cv_t<std::remove_reference_t<typename PipeType::ValueType>>;
+        using KeyType           = std::decay_t<std::invoke_result_t<KeyMapperType&, ElementType&>>;
+        using StateType         = detail::AggregateStateType<AggregatorType, ElementType>;
+        using ValueType         = std::pair<KeyType, detail::AggregateResultType<AggregatorType, ElementType>>;
+        using Clock             = std::chrono::steady_clock;
+        // clang-format on
+
+        static constexpr usize extent = dynamic_extent;
+        static constexpr bool is_timed =
+                detail::TimedPipe<PipeType> && detail::DeadlineKeyMapper<KeyMapperType, KeyType>;
+
+        private:
+        PipeType _pipe;
+        KeyMapperType _key_mapper;
+        AggregatorType _aggregator;
+        StateType _state;
+        Option<KeyType> _key;
+        bool _is_done;
+        [[no_unique_address]] profiling::StageProbe<"tumbling_window"> _probe;
+
+        [[nodiscard]] auto pull_next() noexcept -> Option<typename PipeType::ValueType> {
+            if constexpr(is_timed) {
+                if(_key) {
+                    return _pipe.get_next_until(_key_mapper.get_deadline(*_key));
+                }
+            }
+            return _pipe.get_next();
+        }
+
+        [[nodiscard]] auto read_next() noexcept -> Option<ValueType> {
+            if(_is_done) {
+                return {};
+            }
+            auto element = pull_next();
+            while(element) {
+                ElementType value = *element;
+                auto key = _key_mapper(value);
+                if(_key && !(key == *_key)) {
+                    ValueType result {std::move(*_key), detail::get_aggregate_result(_aggregator, _state)};
+                    _state = _aggregator.template make_state<ElementType>();
+                    _key = std::move(key);
+                    _aggregator.add(_state, value);
+                    return result;
+                }
+                if(!_key) {
+                    _key = std::move(key);
+                }
+                _aggregator.add(_state, value);
+                element = pull_next();
+            }
+            // A timed upstream gives up once the period has passed, which only closes the window
+            if constexpr(is_timed) {
+                _is_done = !_key || Clock::now() < _key_mapper.get_deadline(*_key);
+            }
+            else {
+                _is_done = true;
+            }
+            if(!_key) {
+                return {};
+            }
+            ValueType result {std::move(*_key), detail::get_aggregate_result(_aggregator, _state)};
+            _state = _aggregator.template make_state<ElementType>();
+            _key = {};
+            return result;
+        }
+
+        public:
+        KSTD_DEFAULT_MOVE_COPY(TumblingWindowPipe, Self)
+
+        TumblingWindowPipe(PipeType pipe, KeyMapperType key_mapper, AggregatorType aggregator) noexcept :
+                _pipe {std::move(pipe)},
+                _key_mapper {std::move(key_mapper)},
+                _aggregator {std::move(aggregator)},
+                _state {_aggregator.template make_state<ElementType>()},
+                _key {},
+                _is_done {false},
+                _probe {} {
+        }
+
+        ~TumblingWindowPipe() noexcept = default;
+
+        [[nodiscard]] auto get_size_hint() const noexcept -> usize {
+            // The number of windows depends on the keys of elements which haven't arrived yet
+            return 0;
+        }
+
+        [[nodiscard]] auto get_next() noexcept -> Option<ValueType> {
+            const auto scope = _probe.enter();
+            auto result = read_next();
+            _probe.leave(scope, static_cast<bool>(result));
+            return result;
+        }
+
+        [[nodiscard]] auto get_status() const noexcept -> StreamStatus
+            requires(detail::StatusPipe<PipeType>)
+        {
+            return _pipe.get_status();
+        }
+
+        constexpr auto collect_profile(profiling::StreamProfile& profile) const -> void {
+            _pipe.collect_profile(profile);
+            _probe.collect_profile(profile);
+        }
+
+        auto describe(StreamPlan& plan) const -> void {
+            _pipe.describe(plan);
+            std::string details = "one aggregate per run of equal keys, updated incrementally";
+            if constexpr(is_timed) {
+                details += ", closed at the end of each period";
+            }
+            details += ", " + detail::describe_extent(extent);
+            plan.add_stage(_probe.get_name(), std::move(details));
+        }
+    };
+}// namespace kstd::streams
\ No newline at end of file
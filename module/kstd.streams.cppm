@@ -0,0 +1,164 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+module;
+
+#include <kstd/streams/batch_pipe.hpp>
+#include <kstd/streams/cancellable_pipe.hpp>
+#include <kstd/streams/materialized_view.hpp>
+#include <kstd/streams/parallel.hpp>
+#include <kstd/streams/perf_counters.hpp>
+#include <kstd/streams/resumable_task.hpp>
+#include <kstd/streams/sketches.hpp>
+#include <kstd/streams/spilling.hpp>
+#include <kstd/streams/stream.hpp>
+#include <kstd/streams/trace.hpp>
+#include <kstd/streams/window_pipe.hpp>
+
+/*
+ * Named module exporting the public API of kstd-streams, so its headers are parsed once
+ * per build instead of once per translation unit. Macros can not be exported from a module,
+ * include <kstd/streams/macros.hpp> for the KSTD_*_FUNCTOR helpers. Stage profiles are only
+ * recorded if the module itself is built with KSTD_STREAMS_PROFILING defined.
+ */
+export module kstd.streams;
+
+export namespace kstd::streams {
+    // clang-format off
+    using kstd::streams::AnyPipe;
+    using kstd::streams::AnyStream;
+    using kstd::streams::Batch;
+    using kstd::streams::BatchPipe;
+    using kstd::streams::BufferedPipe;
+    using kstd::streams::CancellablePipe;
+    using kstd::streams::CancellationToken;
+    using kstd::streams::CountMinSketch;
+    using kstd::streams::FrequentElement;
+    using kstd::streams::IotaPipe;
+    using kstd::streams::IteratorPipe;
+    using kstd::streams::LinkedStructPipe;
+    using kstd::streams::MaterializedView;
+    using kstd::streams::MemoryBudget;
+    using kstd::streams::ParallelOptions;
+    using kstd::streams::ParallelStream;
+    using kstd::streams::Pipe;
+    using kstd::streams::PlanStage;
+    using kstd::streams::PrefetchPipe;
+    using kstd::streams::ResumableTask;
+    using kstd::streams::SlidingWindowPipe;
+    using kstd::streams::SoaPipe;
+    using kstd::streams::SpaceSaving;
+    using kstd::streams::SpillingPipe;
+    using kstd::streams::Stream;
+    using kstd::streams::StreamPlan;
+    using kstd::streams::StreamStatus;
+    using kstd::streams::SupplierPipe;
+    using kstd::streams::TimedSupplierPipe;
+    using kstd::streams::TruncationPolicy;
+    using kstd::streams::TumblingWindowPipe;
+
+    using kstd::streams::container_extent;
+    using kstd::streams::dynamic_extent;
+    using kstd::streams::max_inline_buffer_size;
+    using kstd::streams::max_unrolled_extent;
+    using kstd::streams::pipe_extent;
+
+    using kstd::streams::iota;
+    using kstd::streams::materialized_view;
+    using kstd::streams::parallel;
+    using kstd::streams::reverse_stream;
+    using kstd::streams::stream;
+    using kstd::streams::stream_soa;
+    using kstd::streams::stream_until_empty;
+    using kstd::streams::stream_until_empty_timed;
+    using kstd::streams::stream_until_null;
+    // clang-format on
+}// namespace kstd::streams
+
+export namespace kstd::streams::aggregators {
+    using kstd::streams::aggregators::collect;
+    using kstd::streams::aggregators::count;
+    using kstd::streams::aggregators::fold;
+    using kstd::streams::aggregators::group_sum;
+    using kstd::streams::aggregators::GroupTotal;
+    using kstd::streams::aggregators::max;
+    using kstd::streams::aggregators::mean;
+    using kstd::streams::aggregators::min;
+    using kstd::streams::aggregators::sum;
+}// namespace kstd::streams::aggregators
+
+export namespace kstd::streams::collectors {
+    using kstd::streams::collectors::insert;
+    using kstd::streams::collectors::joining;
+    using kstd::streams::collectors::plus_assign;
+    using kstd::streams::collectors::push_back;
+    using kstd::streams::collectors::subscript;
+    using kstd::streams::collectors::subscript_indexed;
+    using kstd::streams::collectors::subscript_indexed_reverse;
+}// namespace kstd::streams::collectors
+
+export namespace kstd::streams::comparators {
+    using kstd::streams::comparators::deref_greater_than;
+    using kstd::streams::comparators::deref_less_than;
+}// namespace kstd::streams::comparators
+
+export namespace kstd::streams::filters {
+    using kstd::streams::filters::even;
+    using kstd::streams::filters::non_null;
+    using kstd::streams::filters::non_zero;
+    using kstd::streams::filters::odd;
+}// namespace kstd::streams::filters
+
+export namespace kstd::streams::mappers {
+    using kstd::streams::mappers::address_of;
+    using kstd::streams::mappers::as_non_zero;
+    using kstd::streams::mappers::as_option;
+    using kstd::streams::mappers::dereference;
+    using kstd::streams::mappers::first;
+    using kstd::streams::mappers::format;
+    using kstd::streams::mappers::second;
+}// namespace kstd::streams::mappers
+
+export namespace kstd::streams::profiling {
+    using kstd::streams::profiling::HardwareCounters;
+    using kstd::streams::profiling::PerfCounters;
+    using kstd::streams::profiling::StreamProfile;
+    using kstd::streams::profiling::TraceEvent;
+    using kstd::streams::profiling::TraceRecorder;
+    using kstd::streams::profiling::TraceSpan;
+
+    using kstd::streams::profiling::measure_hardware_counters;
+    using kstd::streams::profiling::trace;
+    using kstd::streams::profiling::trace_instant;
+#ifdef KSTD_STREAMS_PROFILING
+    using kstd::streams::profiling::StageProfile;
+
+    using kstd::streams::profiling::profile_with_hardware_counters;
+#endif
+}// namespace kstd::streams::profiling
+
+export namespace kstd::streams::reducers {
+    using kstd::streams::reducers::add;
+    using kstd::streams::reducers::divide;
+    using kstd::streams::reducers::length_sq;
+    using kstd::streams::reducers::modulo;
+    using kstd::streams::reducers::multiply;
+    using kstd::streams::reducers::subtract;
+}// namespace kstd::streams::reducers
\ No newline at end of file
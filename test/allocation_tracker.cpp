@@ -0,0 +1,75 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include "allocation_tracker.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace kstd::streams::test {
+    auto get_allocation_counters() noexcept -> AllocationCounters& {
+        thread_local AllocationCounters counters {};
+        return counters;
+    }
+}// namespace kstd::streams::test
+
+namespace {
+    auto allocate(std::size_t size) -> void* {
+        auto& counters = kstd::streams::test::get_allocation_counters();
+        ++counters.allocations;
+        counters.allocated_bytes += size;
+        if(auto* memory = std::malloc(size == 0 ? 1 : size)) {
+            return memory;
+        }
+        throw std::bad_alloc {};
+    }
+
+    auto deallocate(void* memory) noexcept -> void {
+        if(memory == nullptr) {
+            return;
+        }
+        ++kstd::streams::test::get_allocation_counters().deallocations;
+        std::free(memory);
+    }
+}// namespace
+
+auto operator new(std::size_t size) -> void* {
+    return allocate(size);
+}
+
+auto operator new[](std::size_t size) -> void* {
+    return allocate(size);
+}
+
+auto operator delete(void* memory) noexcept -> void {
+    deallocate(memory);
+}
+
+auto operator delete[](void* memory) noexcept -> void {
+    deallocate(memory);
+}
+
+auto operator delete(void* memory, std::size_t) noexcept -> void {
+    deallocate(memory);
+}
+
+auto operator delete[](void* memory, std::size_t) noexcept -> void {
+    deallocate(memory);
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#pragma once
+
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+
+namespace kstd::streams::test {
+    struct AllocationCounters final {
+        usize allocations;
+        usize deallocations;
+        usize allocated_bytes;
+    };
+
+    /**
+     * The allocation counters of the calling thread, updated by the replaced
+     * global operator new and delete in allocation_tracker.cpp.
+     */
+    [[nodiscard]] auto get_allocation_counters() noexcept -> AllocationCounters&;
+
+    /**
+     * Records all allocations made on the calling thread during its lifetime.
+     */
+    struct AllocationTracker final {
+        private:
+        AllocationCounters _start;
+
+        public:
+        KSTD_NO_MOVE_COPY(AllocationTracker, AllocationTracker)
+
+        AllocationTracker() noexcept :
+                _start {get_allocation_counters()} {
+        }
+
+        ~AllocationTracker() noexcept = default;
+
+        [[nodiscard]] auto get_allocations() const noexcept -> usize {
+            return get_allocation_counters().allocations - _start.allocations;
+        }
+
+        [[nodiscard]] auto get_deallocations() const noexcept -> usize {
+            return get_allocation_counters().deallocations - _start.deallocations;
+        }
+
+        [[nodiscard]] auto get_allocated_bytes() const noexcept -> usize {
+            return get_allocation_counters().allocated_bytes - _start.allocated_bytes;
+        }
+    };
+}// namespace kstd::streams::test
\ No newline at end of file
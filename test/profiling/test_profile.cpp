@@ -0,0 +1,135 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+// Built into kstd-streams-profiling-tests, which defines KSTD_STREAMS_PROFILING for all of its sources
+#ifdef KSTD_STREAMS_PROFILING
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <kstd/streams/parallel.hpp>
+#include <kstd/streams/stream.hpp>
+#include <kstd/streams/trace.hpp>
+#include <string_view>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_profile_stages) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::i16> values {};
+    for(kstd::i16 value = 0; value < 100; ++value) {
+        values.push_back(value);
+    }
+
+    profiling::StreamProfile profile {};
+    // clang-format off
+    const auto sum = stream(values)
+        .filter([](auto& value) { return value % 4 == 0; })
+        .map([](auto& value) { return static_cast<kstd::i16>(value * 2); })
+        .sort()
+        .profile([](auto& stream) { return stream.sum(); }, profile);
+    // clang-format on
+    ASSERT_EQ(sum, 2400);
+
+    const auto& stages = profile.get_stages();
+    ASSERT_EQ(stages.size(), 5);
+
+    ASSERT_STREQ(stages[0].name, "iterator");
+    ASSERT_EQ(stages[0].elements_out, 100);
+
+    ASSERT_STREQ(stages[1].name, "filter");
+    ASSERT_EQ(stages[1].elements_in, 100);
+    ASSERT_EQ(stages[1].elements_out, 25);
+
+    ASSERT_STREQ(stages[2].name, "map");
+    ASSERT_EQ(stages[2].elements_in, 25);
+    ASSERT_EQ(stages[2].elements_out, 25);
+
+    ASSERT_STREQ(stages[3].name, "sort");
+    ASSERT_EQ(stages[3].elements_in, 25);
+    ASSERT_EQ(stages[3].elements_out, 25);
+
+    ASSERT_STREQ(stages[4].name, "terminal");
+    ASSERT_EQ(stages[4].elements_in, 25);
+    ASSERT_FALSE(profile.to_string().empty());
+}
+
+TEST(kstd_streams_Stream, test_profile_for_each) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::i8> values {1, 2, 3};
+    profiling::StreamProfile profile {};
+    stream(values).profile(
+            [](auto& stream) {
+                stream.for_each([](auto& value) {
+                    value *= 2;
+                });
+            },
+            profile);
+
+    ASSERT_EQ(values[2], 6);
+    ASSERT_EQ(profile.get_stages().size(), 2);
+    ASSERT_EQ(profile.get_stages()[1].elements_in, 3);
+}
+
+TEST(kstd_streams_Stream, test_profile_trace_buffer) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::i16> values {3, 1, 2};
+    profiling::TraceRecorder recorder {};
+    profiling::TraceRecorder::set_active(&recorder);
+    const auto sum = stream(values).sort().sum();
+    profiling::TraceRecorder::set_active(nullptr);
+    ASSERT_EQ(sum, 6);
+
+    const auto events = recorder.get_events();
+    ASSERT_EQ(events.size(), 1);
+    ASSERT_STREQ(events[0].name, "sort");
+    ASSERT_STREQ(events[0].category, "buffer");
+    ASSERT_FALSE(events[0].is_instant);
+}
+
+TEST(kstd_streams_Stream, test_profile_trace_parallel) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u64> values(1024, 1);
+    profiling::TraceRecorder recorder {};
+    profiling::TraceRecorder::set_active(&recorder);
+    const auto sum = parallel(values, {.threads = 4, .grain_size = 64, .numa_aware = false}).sum();
+    const auto count = parallel(values, {.threads = 1}).count();
+    profiling::TraceRecorder::set_active(nullptr);
+    ASSERT_EQ(sum, values.size());
+    ASSERT_EQ(count, values.size());
+
+    const auto events = recorder.get_events();
+    const auto count_events = [&](const char* name) -> kstd::usize {
+        return static_cast<kstd::usize>(std::count_if(events.cbegin(), events.cend(), [&](const auto& event) {
+            return std::string_view {event.name} == name && std::string_view {event.category} == "parallel";
+        }));
+    };
+    // Only the first run is split, the second one samples its grain size and stays on the calling thread
+    ASSERT_EQ(count_events("split"), 1);
+    ASSERT_EQ(count_events("sample"), 1);
+    ASSERT_GE(count_events("chunk"), values.size() / 64);
+    ASSERT_EQ(count_events("merge"), 2);
+    // Without NUMA awareness there is a single queue, so nothing is ever stolen
+    ASSERT_EQ(count_events("steal"), 0);
+}
+
+#endif// KSTD_STREAMS_PROFILING
\ No newline at end of file
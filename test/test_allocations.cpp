@@ -0,0 +1,154 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include "allocation_tracker.hpp"
+#include <array>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <set>
+#include <span>
+#include <vector>
+
+struct SomeAllocationRecord final {
+    kstd::u64 id;
+    kstd::f64 weight;
+};
+
+struct SomeAllocationNode final {
+    kstd::u64 value;
+    SomeAllocationNode* next;
+};
+
+TEST(kstd_streams_Stream, test_allocations_stages) {
+    using namespace kstd::streams;
+    using namespace kstd::streams::test;
+
+    std::vector<kstd::u64> values {1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<kstd::u64*> addresses {&values[0], &values[1], &values[2]};
+    const AllocationTracker tracker {};
+
+    kstd::u64 peeked = 0;
+    const auto sum = stream(values)
+                             .map([](auto& value) { return value * 2; })
+                             .filter(filters::even)
+                             .peek([&](auto value) { peeked += value; })
+                             .sum();
+    ASSERT_EQ(sum, 72);
+    ASSERT_EQ(peeked, 72);
+    ASSERT_EQ(stream(addresses).deref_all().count(), 3);
+    ASSERT_EQ(stream(values).address_of_all().count(), 8);
+    ASSERT_EQ(stream(values).reduce([](auto a, auto b) { return a + b; }), 36);
+    ASSERT_EQ(*stream(values).find_first([](auto& value) { return value > 4; }), 5);
+    ASSERT_EQ(*stream(values).find_last([](auto& value) { return value < 4; }), 3);
+    ASSERT_EQ(stream(values).index_of([](auto& value) { return value == 6; }), 5);
+    ASSERT_EQ((iota<0, 16>().sum()), 120);
+
+    ASSERT_EQ(tracker.get_allocations(), 0);
+    ASSERT_EQ(tracker.get_allocated_bytes(), 0);
+}
+
+TEST(kstd_streams_Stream, test_allocations_sources) {
+    using namespace kstd::streams;
+    using namespace kstd::streams::test;
+
+    std::vector<kstd::u64> ids {1, 2, 3};
+    std::vector<kstd::f64> weights {1.0, 2.0, 3.0};
+    SomeAllocationNode third {3, nullptr};
+    SomeAllocationNode second {2, &third};
+    SomeAllocationNode first {1, &second};
+    kstd::u64 c_array[4] {1, 2, 3, 4};// NOLINT
+    const AllocationTracker tracker {};
+
+    ASSERT_EQ(stream(c_array).sum(), 10);
+    ASSERT_EQ(stream_soa(ids, weights).count(), 3);
+    ASSERT_EQ(stream_until_null(&first, KSTD_PTR_FIELD_FUNCTOR(next)).count(), 3);
+
+    ASSERT_EQ(tracker.get_allocations(), 0);
+}
+
+TEST(kstd_streams_Stream, test_allocations_collectors) {
+    using namespace kstd::streams;
+    using namespace kstd::streams::test;
+
+    const std::vector<kstd::u64> values {4, 3, 2, 1};
+    std::vector<kstd::u64> reserved {};
+    reserved.reserve(values.size());
+    std::vector<kstd::u64> sized(values.size());
+    std::array<kstd::u64, 4> span_storage {};
+    const AllocationTracker tracker {};
+
+    stream(values).collect_into(reserved, collectors::push_back);
+    stream(values).collect_into(sized, collectors::subscript_indexed);
+    stream(values).collect_into(sized, collectors::subscript_indexed_reverse);
+    ASSERT_EQ(stream(values).collect_into_span(std::span {span_storage}), 4);
+    const auto array = stream(span_storage).collect_array();
+
+    ASSERT_EQ(tracker.get_allocations(), 0);
+    ASSERT_EQ(reserved.size(), 4);
+    ASSERT_EQ(sized[0], 1);
+    ASSERT_EQ(array[3], 1);
+}
+
+TEST(kstd_streams_Stream, test_allocations_buffered) {
+    using namespace kstd::streams;
+    using namespace kstd::streams::test;
+
+    const std::vector<kstd::u64> values {6, 5, 4, 3, 2, 1};
+    const std::array<kstd::u64, 6> array_values {6, 5, 4, 3, 2, 1};
+
+    {
+        const AllocationTracker tracker {};
+        ASSERT_EQ(*stream(array_values).sort().find_first([](auto&) { return true; }), 1);
+        ASSERT_EQ(tracker.get_allocations(), 0);
+    }
+
+    {
+        const AllocationTracker tracker {};
+        ASSERT_EQ(*stream(values).sort().find_first([](auto&) { return true; }), 1);
+        ASSERT_EQ(tracker.get_allocations(), 1);
+        ASSERT_EQ(tracker.get_allocated_bytes(), values.size() * sizeof(kstd::u64));
+        ASSERT_EQ(tracker.get_deallocations(), 1);
+    }
+
+    {
+        // The buffer is only reserved for exact size hints, which a filter does not give
+        const AllocationTracker tracker {};
+        const auto is_one = [](auto& value) { return value == 1; };
+        ASSERT_EQ(*stream(values).filter(is_one).sort().find_first([](auto&) { return true; }), 1);
+        ASSERT_EQ(tracker.get_allocations(), 1);
+        ASSERT_EQ(tracker.get_allocated_bytes(), sizeof(kstd::u64));
+    }
+}
+
+TEST(kstd_streams_Stream, test_allocations_collect) {
+    using namespace kstd::streams;
+    using namespace kstd::streams::test;
+
+    const std::vector<SomeAllocationRecord> values {{1, 1.0}, {2, 2.0}, {3, 3.0}};
+    const AllocationTracker tracker {};
+
+    const auto [ids, weights] = stream(values).collect_soa<&SomeAllocationRecord::id, &SomeAllocationRecord::weight>();
+    ASSERT_EQ(tracker.get_allocations(), 2);
+    ASSERT_EQ(tracker.get_allocated_bytes(), values.size() * (sizeof(kstd::u64) + sizeof(kstd::f64)));
+
+    const auto set = stream(values).map([](auto& value) { return value.id; }).collect<std::set>(collectors::insert);
+    ASSERT_EQ(set.size(), values.size());
+    ASSERT_EQ(tracker.get_allocations(), 2 + values.size());
+}
\ No newline at end of file
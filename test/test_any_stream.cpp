@@ -0,0 +1,104 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    auto make_even_squares(const std::vector<kstd::u32>& values) -> kstd::streams::AnyStream<kstd::u32> {
+        using namespace kstd::streams;
+        return stream(values).filter(filters::even).map([](auto& value) { return value * value; }).erase();
+    }
+}// namespace
+
+TEST(kstd_streams_Stream, test_any_stream) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 value = 0; value < 200; ++value) {
+        values.push_back(value);
+    }
+
+    auto squares = make_even_squares(values).stream();
+    kstd::u32 expected = 0;
+    for(kstd::u32 value = 0; value < 200; value += 2) {
+        expected += value * value;
+    }
+    ASSERT_EQ(squares.sum(), expected);
+    ASSERT_EQ(make_even_squares(values).stream().count(), 100);
+    auto odd_squares = make_even_squares(values).stream().map([](auto value) { return value + 1; });
+    ASSERT_FALSE(odd_squares.find_first(filters::even));
+}
+
+TEST(kstd_streams_Stream, test_any_stream_read_ahead) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values(200);
+    kstd::usize consumed = 0;
+    auto erased = stream(values).peek([&](auto&) { ++consumed; }).erase().stream();
+    ASSERT_TRUE(erased.find_first([](auto&) { return true; }));
+    // The whole first batch is pulled, not just the element find_first stops at
+    static_assert(AnyPipe<kstd::u32>::batch_size == 64);
+    ASSERT_EQ(consumed, AnyPipe<kstd::u32>::batch_size);
+}
+
+TEST(kstd_streams_Stream, test_any_stream_container) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector values {"Hello"s, "World"s, "OwO"s};
+    const std::vector<kstd::u32> numbers {3, 1, 2};
+
+    std::vector<AnyStream<std::string>> streams {};
+    streams.push_back(stream(values).erase());
+    streams.push_back(stream(values).sort().erase());
+    streams.push_back(stream(numbers).map([](auto& value) { return std::to_string(value); }).erase());
+    ASSERT_EQ(streams.size(), 3);
+
+    const auto first = streams[0].stream().collect<std::vector>(collectors::push_back);
+    const auto second = streams[1].stream().collect<std::vector>(collectors::push_back);
+    const auto third = streams[2].stream().collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(first, values);
+    ASSERT_EQ(second, (std::vector {"Hello"s, "OwO"s, "World"s}));
+    ASSERT_EQ(third, (std::vector {"3"s, "1"s, "2"s}));
+}
+
+TEST(kstd_streams_Stream, test_any_stream_pointers) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {1, 2, 3};
+    stream(values).address_of_all().erase().stream().for_each([](auto* value) { *value *= 2; });
+    ASSERT_EQ(values, (std::vector<kstd::u32> {2, 4, 6}));
+}
+
+TEST(kstd_streams_Stream, test_any_stream_heap) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u64> values {1, 2, 3};
+    std::array<kstd::u64, 16> padding {};
+    auto inline_stream = stream(values).erase().stream();
+    auto heap_stream = stream(values).map([padding](auto& value) { return value + padding[0]; }).erase().stream();
+    ASSERT_TRUE(inline_stream.explain().to_string().find("stored inline") != std::string::npos);
+    ASSERT_TRUE(heap_stream.explain().to_string().find("stored on the heap") != std::string::npos);
+    ASSERT_EQ(heap_stream.sum(), 6);
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <kstd/streams/batch_pipe.hpp>
+#include <kstd/streams/stream.hpp>
+#include <limits>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_batch) {
+    using namespace kstd::streams;
+
+    kstd::u32 next = 0;
+    std::vector<kstd::usize> sizes {};
+    std::vector<kstd::u32> elements {};
+    std::set<const kstd::u32*> storages {};
+    stream_until_empty([&]() -> kstd::Option<kstd::u32> {
+        if(next == 1050) {
+            return {};
+        }
+        return next++;
+    })
+            .batch(100)
+            .for_each([&](auto& batch) {
+                sizes.push_back(batch.get_size());
+                elements.insert(elements.end(), batch.begin(), batch.end());
+                storages.insert(batch.get_elements().data());
+            });
+
+    // At most the current and the next batch are alive at once, all other vectors are recycled
+    ASSERT_LE(storages.size(), 2);
+    ASSERT_EQ(sizes.size(), 11);
+    ASSERT_EQ(sizes.back(), 50);
+    ASSERT_EQ(elements.size(), 1050);
+    for(kstd::u32 index = 0; index < elements.size(); ++index) {
+        ASSERT_EQ(elements[index], index);
+    }
+}
+
+TEST(kstd_streams_Stream, test_batch_latency) {
+    using namespace kstd::streams;
+
+    kstd::u32 next = 0;
+    std::vector<kstd::usize> sizes {};
+    stream_until_empty([&]() -> kstd::Option<kstd::u32> {
+        if(next == 20) {
+            return {};
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds {1});
+        return next++;
+    })
+            .batch(1000, std::chrono::milliseconds {5})
+            .for_each([&](auto& batch) { sizes.push_back(batch.get_size()); });
+
+    ASSERT_GT(sizes.size(), 1);
+    kstd::usize total = 0;
+    for(const auto size : sizes) {
+        ASSERT_LT(size, 1000);
+        total += size;
+    }
+    ASSERT_EQ(total, 20);
+}
+
+TEST(kstd_streams_Stream, test_batch_unbounded) {
+    using namespace kstd::streams;
+
+    // Without an upper bound on its size, a batch only reserves a little and grows with its elements
+    std::vector<kstd::u32> values(5000);
+    std::vector<kstd::usize> sizes {};
+    stream(values)
+            .batch(std::numeric_limits<kstd::usize>::max(), std::chrono::seconds {10})
+            .for_each([&](auto& batch) { sizes.push_back(batch.get_size()); });
+    ASSERT_EQ(sizes, (std::vector<kstd::usize> {values.size()}));
+
+    // A latency too long for nanoseconds means no latency limit instead of overflowing
+    sizes.clear();
+    stream(values)
+            .batch(std::numeric_limits<kstd::usize>::max(), std::chrono::hours::max())
+            .for_each([&](auto& batch) { sizes.push_back(batch.get_size()); });
+    ASSERT_EQ(sizes, (std::vector<kstd::usize> {values.size()}));
+    using Pipe = BatchPipe<IteratorPipe<typename std::vector<kstd::u32>::iterator>>;
+    static_assert(Pipe::to_max_latency(std::chrono::hours::max()) == Pipe::Clock::duration::max());
+    static_assert(Pipe::to_max_latency(std::chrono::seconds {10}) == std::chrono::seconds {10});
+}
+
+TEST(kstd_streams_Stream, test_batch_release) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5};
+    std::vector<std::vector<kstd::u32>> batches {};
+    stream(values).batch(2).for_each([&](auto& batch) { batches.push_back(batch.release()); });
+    ASSERT_EQ(batches, (std::vector<std::vector<kstd::u32>> {{1, 2}, {3, 4}, {5}}));
+}
+
+TEST(kstd_streams_Stream, test_batch_late_element) {
+    using namespace kstd::streams;
+
+    kstd::u32 next = 0;
+    std::vector<std::vector<kstd::u32>> batches {};
+    stream_until_empty([&]() -> kstd::Option<kstd::u32> {
+        if(next == 3) {
+            return {};
+        }
+        if(next == 1) {
+            std::this_thread::sleep_for(std::chrono::milliseconds {20});
+        }
+        return next++;
+    })
+            .batch(1000, std::chrono::milliseconds {5})
+            .for_each([&](auto& batch) { batches.push_back(batch.release()); });
+
+    // The element arriving after the deadline does not join the batch that was already due
+    ASSERT_EQ(batches, (std::vector<std::vector<kstd::u32>> {{0}, {1, 2}}));
+}
+
+TEST(kstd_streams_Stream, test_batch_timed_supplier) {
+    using namespace kstd::streams;
+    using Clock = std::chrono::steady_clock;
+
+    kstd::u32 calls = 0;
+    std::vector<std::vector<kstd::u32>> batches {};
+    std::vector<Clock::duration> waits {};
+    stream_until_empty_timed([&](Clock::time_point deadline) -> kstd::Option<kstd::u32> {
+        switch(calls++) {
+            case 0: return 0;
+            case 1:
+                // Nothing arrives in time, so the pending batch is flushed at the deadline
+                waits.push_back(deadline - Clock::now());
+                std::this_thread::sleep_until(deadline);
+                return {};
+            case 2:
+                waits.push_back(deadline - Clock::now());
+                return 1;
+            default: return {};// Closed before the deadline, which ends the stream
+        }
+    })
+            .batch(1000, std::chrono::milliseconds {5})
+            .for_each([&](auto& batch) { batches.push_back(batch.release()); });
+
+    ASSERT_EQ(batches, (std::vector<std::vector<kstd::u32>> {{0}, {1}}));
+    ASSERT_EQ(waits.size(), 2);
+    ASSERT_LE(waits[0], std::chrono::milliseconds {5});
+    ASSERT_GT(waits[1], std::chrono::hours {1});// Without a pending batch there is no deadline
+    ASSERT_EQ(calls, 4);
+}
+
+TEST(kstd_streams_Stream, test_batch_move_only) {
+    using namespace kstd::streams;
+
+    kstd::i32 next = 0;
+    kstd::i32 sum = 0;
+    stream_until_empty([&]() -> kstd::Option<std::unique_ptr<kstd::i32>> {
+        if(next == 5) {
+            return {};
+        }
+        return std::make_unique<kstd::i32>(next++);
+    })
+            .batch(2)
+            .for_each([&](auto& batch) {
+                for(const auto& element : batch) {
+                    sum += *element;
+                }
+            });
+    ASSERT_EQ(sum, 10);
+}
\ No newline at end of file
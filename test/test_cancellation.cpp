@@ -0,0 +1,134 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <kstd/streams/cancellable_pipe.hpp>
+#include <kstd/streams/parallel.hpp>
+#include <kstd/streams/stream.hpp>
+#include <random>
+#include <stop_token>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_with_cancellation) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values(100000, 1);
+    std::stop_source source {};
+    kstd::usize seen = 0;
+    auto cancelled = stream(values)
+                             .with_cancellation(CancellationToken {source.get_token()})
+                             .peek([&](auto&) {
+                                 if(++seen == 5000) {
+                                     source.request_stop();
+                                 }
+                             });
+    const auto count = cancelled.count();
+    ASSERT_GE(count, 5000);
+    ASSERT_LT(count, 5000 + detail::cancellation_check_interval + 1);
+    ASSERT_TRUE(cancelled.was_cancelled());
+
+    auto completed = stream(values).with_cancellation(CancellationToken {});
+    ASSERT_EQ(completed.count(), values.size());
+    ASSERT_FALSE(completed.was_cancelled());
+
+    const auto expired = CancellationToken::deadline(std::chrono::steady_clock::now());
+    ASSERT_TRUE(expired.is_cancelled());
+    auto empty = stream(values).with_cancellation(expired);
+    ASSERT_EQ(empty.count(), 0);
+    ASSERT_TRUE(empty.was_cancelled());
+    ASSERT_FALSE(CancellationToken::timeout(std::chrono::hours {1}).is_cancelled());
+
+    // The stream may end at any check, so its size is unknown even before it has been cancelled
+    using Iterator = typename std::vector<kstd::u32>::const_iterator;
+    CancellablePipe pipe {IteratorPipe<Iterator> {values.cbegin(), values.cend()}, CancellationToken {}};
+    ASSERT_EQ(pipe.get_size_hint(), 0);
+}
+
+TEST(kstd_streams_Stream, test_stream_until_empty_cancellation) {
+    using namespace kstd::streams;
+
+    std::stop_source source {};
+    kstd::u32 next = 0;
+    const auto sum = stream_until_empty(
+                             [&]() -> kstd::Option<kstd::u32> {
+                                 if(++next == 3000) {
+                                     source.request_stop();
+                                 }
+                                 return 1;
+                             },
+                             CancellationToken {source.get_token()})
+                             .sum();
+    ASSERT_GE(sum, 3000);
+    ASSERT_LE(sum, 3000 + detail::cancellation_check_interval);
+}
+
+TEST(kstd_streams_Stream, test_sort_cancellation) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values(20000);
+    std::mt19937 random {1234};
+    std::generate(values.begin(), values.end(), random);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    const auto sorted = stream(values).sort(CancellationToken {}).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(sorted, expected);
+    std::reverse(expected.begin(), expected.end());
+    const auto reversed = stream(values).reverse_sort(CancellationToken {}).collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(reversed, expected);
+
+    auto completed = stream(values).sort(CancellationToken {});
+    ASSERT_EQ(completed.count(), values.size());
+    ASSERT_FALSE(completed.was_cancelled());
+
+    const auto expired = CancellationToken::deadline(std::chrono::steady_clock::now());
+    auto empty = stream(values).sort(expired);
+    ASSERT_EQ(empty.count(), 0);
+    ASSERT_TRUE(empty.was_cancelled());
+    auto reverse_empty = stream(values).reverse_sort(detail::less_than, expired);
+    ASSERT_EQ(reverse_empty.count(), 0);
+    ASSERT_TRUE(reverse_empty.was_cancelled());
+    ASSERT_FALSE(stream(values).map([](auto value) { return value; }).was_cancelled());
+}
+
+TEST(kstd_streams_Stream, test_parallel_cancellation) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values(100000, 1);
+    ParallelOptions options {};
+    options.threads = 4;
+    options.cancellation = CancellationToken::deadline(std::chrono::steady_clock::now());
+    kstd::usize calls = 0;
+    auto cancelled = parallel(values, options);
+    ASSERT_FALSE(cancelled.was_cancelled());
+    cancelled.for_each([&](auto&) { ++calls; });
+    ASSERT_EQ(calls, 0);
+    ASSERT_TRUE(cancelled.was_cancelled());
+
+    // A token cancelled after a completed run does not mark it as cancelled
+    std::stop_source source {};
+    options.cancellation = CancellationToken {source.get_token()};
+    auto completed = parallel(values, options);
+    ASSERT_EQ(completed.sum(), values.size());
+    source.request_stop();
+    ASSERT_FALSE(completed.was_cancelled());
+}
\ No newline at end of file
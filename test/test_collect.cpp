@@ -17,8 +17,10 @@
  * @since 18/07/2023
  */
 
+#include <array>
 #include <gtest/gtest.h>
 #include <kstd/streams/stream.hpp>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -97,4 +99,78 @@ TEST(kstd_streams_Stream, test_collect_string_joining) {
     const auto num_values = values.size();
     ASSERT_EQ((num_values << 1) - 1, value.length());
     ASSERT_EQ(value, "O\tw\tO\t!");
+}
+
+TEST(kstd_streams_Stream, test_collect_subscript_indexed_reverse) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5};
+    std::vector<kstd::u32> reversed_values(values.size());
+    stream(values).collect_into(reversed_values, collectors::subscript_indexed_reverse);
+    const auto num_values = values.size();
+    ASSERT_EQ(num_values, reversed_values.size());
+
+    for(kstd::usize index = 0; index < num_values; ++index) {
+        ASSERT_EQ(values[index], reversed_values[num_values - 1 - index]);
+    }
+}
+
+TEST(kstd_streams_Stream, test_collect_into_span) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5};
+    std::array<kstd::u32, 8> buffer {};
+    const auto num_written = stream(values).collect_into_span(std::span<kstd::u32> {buffer});
+    ASSERT_EQ(num_written, values.size());
+
+    for(kstd::usize index = 0; index < num_written; ++index) {
+        ASSERT_EQ(values[index], buffer[index]);
+    }
+}
+
+TEST(kstd_streams_Stream, test_collect_into_span_truncated) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5};
+    std::array<kstd::u32, 3> buffer {};
+    kstd::usize num_peeked = 0;
+    // clang-format off
+    const auto num_written = stream(values)
+        .peek([&](auto&) { ++num_peeked; })
+        .collect_into_span(std::span<kstd::u32> {buffer});
+    // clang-format on
+    ASSERT_EQ(num_written, buffer.size());
+    ASSERT_EQ(num_peeked, buffer.size());
+    ASSERT_EQ(buffer[2], 3);
+
+    num_peeked = 0;
+    // clang-format off
+    stream(values)
+        .peek([&](auto&) { ++num_peeked; })
+        .collect_into_span(std::span<kstd::u32> {buffer}, TruncationPolicy::DRAIN);
+    // clang-format on
+    ASSERT_EQ(num_peeked, values.size());
+
+    // Sources with a static extent have to be drained just the same
+    const std::array<kstd::u32, 5> fixed_values {1, 2, 3, 4, 5};
+    std::array<kstd::u32, 2> fixed_buffer {};
+    num_peeked = 0;
+    // clang-format off
+    const auto num_fixed_written = stream(fixed_values)
+        .peek([&](auto&) { ++num_peeked; })
+        .collect_into_span(std::span<kstd::u32> {fixed_buffer}, TruncationPolicy::DRAIN);
+    // clang-format on
+    ASSERT_EQ(num_fixed_written, fixed_buffer.size());
+    ASSERT_EQ(num_peeked, fixed_values.size());
+}
+
+TEST(kstd_streams_Stream, test_collect_array) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5};
+    const auto array = stream(values).filter(filters::odd).collect_array<4>();
+    ASSERT_EQ(array[0], 1);
+    ASSERT_EQ(array[1], 3);
+    ASSERT_EQ(array[2], 5);
+    ASSERT_EQ(array[3], 0);
 }
\ No newline at end of file
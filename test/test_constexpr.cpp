@@ -0,0 +1,84 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <vector>
+
+namespace {
+    constexpr auto make_sorted_table() noexcept -> std::array<kstd::u32, 6> {
+        using namespace kstd::streams;
+        std::array<kstd::u32, 6> values {4, 5, 6, 1, 3, 2};
+        return stream(values).sort().collect_array<6>();
+    }
+
+    constexpr auto make_distinct_table() noexcept -> std::array<kstd::u32, 4> {
+        using namespace kstd::streams;
+        std::array<kstd::u32, 8> values {3, 1, 3, 2, 1, 4, 4, 2};
+        return stream(values).distinct().sort().collect_array<4>();
+    }
+
+    constexpr auto sum_odd_squares() noexcept -> kstd::u32 {
+        using namespace kstd::streams;
+        const std::vector<kstd::u32> values {1, 2, 3, 4, 5};
+        // clang-format off
+        return stream(values)
+            .filter(filters::odd)
+            .map([](auto& value) { return value * value; })
+            .sum();
+        // clang-format on
+    }
+
+    constexpr auto sum_pointees() noexcept -> kstd::i32 {
+        using namespace kstd::streams;
+        kstd::i32 first = 1;
+        kstd::i32 second = 2;
+        kstd::i32 third = 4;
+        std::array<kstd::i32*, 3> pointers {&first, &second, &third};
+        const auto direct = stream(pointers).deref_all().sum();
+        auto read_ahead = stream(pointers).filter([](auto* pointer) { return *pointer > 1; }).prefetch(2).deref_all();
+        return direct + read_ahead.sum();
+    }
+}// namespace
+
+TEST(kstd_streams_Stream, test_constexpr_sort) {
+    constexpr auto table = make_sorted_table();
+    static_assert(table == std::array<kstd::u32, 6> {1, 2, 3, 4, 5, 6});
+    ASSERT_EQ(table, make_sorted_table());
+}
+
+TEST(kstd_streams_Stream, test_constexpr_distinct) {
+    constexpr auto table = make_distinct_table();
+    static_assert(table == std::array<kstd::u32, 4> {1, 2, 3, 4});
+    ASSERT_EQ(table, make_distinct_table());
+}
+
+TEST(kstd_streams_Stream, test_constexpr_vector) {
+    constexpr auto sum = sum_odd_squares();
+    static_assert(sum == 35);
+    ASSERT_EQ(sum, sum_odd_squares());
+}
+
+TEST(kstd_streams_Stream, test_constexpr_deref_all) {
+    constexpr auto sum = sum_pointees();
+    static_assert(sum == 13);
+    ASSERT_EQ(sum, sum_pointees());
+}
\ No newline at end of file
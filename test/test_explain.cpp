@@ -0,0 +1,88 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_explain) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {4, 3, 2, 1};
+    const auto plan = stream(values).filter(filters::even).map([](auto& value) { return value * 2; }).explain();
+    const auto& stages = plan.get_stages();
+    ASSERT_EQ(stages.size(), 4);
+    ASSERT_STREQ(stages[0].name, "iterator");
+    ASSERT_EQ(stages[0].details, "contiguous iterator, size 4, dynamic extent, splittable");
+    ASSERT_STREQ(stages[1].name, "filter");
+    ASSERT_EQ(stages[1].details, "fused, dynamic extent");
+    ASSERT_STREQ(stages[2].name, "map");
+    ASSERT_STREQ(stages[3].name, "terminal");
+    ASSERT_EQ(stages[3].details, "pull loop");
+    ASSERT_EQ(plan.to_string().find("iterator: contiguous iterator"), 0);
+}
+
+TEST(kstd_streams_Stream, test_explain_names_are_free) {
+    using namespace kstd::streams;
+
+    // Stage names are template arguments, so describing a pipeline does not make its pipes any larger
+    using Source = IteratorPipe<kstd::u32*>;
+    static_assert(std::is_empty_v<profiling::StageProbe<"map">>);
+    static_assert(sizeof(Source) == sizeof(kstd::u32*) * 2);
+    static_assert(sizeof(PrefetchPipe<IteratorPipe<kstd::u32**>>) == sizeof(Source) + sizeof(kstd::usize));
+
+    std::vector<kstd::u32> values {1, 2, 3};
+    auto values_stream = stream(values).map([](auto value) { return value; });
+    ASSERT_STREQ(values_stream.explain().get_stages()[1].name, "map");
+}
+
+TEST(kstd_streams_Stream, test_explain_does_not_consume) {
+    using namespace kstd::streams;
+
+    std::list<kstd::u32> values {1, 2, 3};
+    auto values_stream = stream(values);
+    ASSERT_EQ(values_stream.explain().get_stages()[0].details,
+              "bidirectional iterator, size unknown, dynamic extent, not splittable");
+    ASSERT_EQ(values_stream.sum(), 6);
+}
+
+TEST(kstd_streams_Stream, test_explain_buffered) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {4, 3, 2, 1};
+    std::array<kstd::u32, 4> array {4, 3, 2, 1};
+
+    const auto plan = stream(values).sort().explain();
+    ASSERT_EQ(plan.get_stages().size(), 2);
+    ASSERT_STREQ(plan.get_stages()[0].name, "sort");
+    ASSERT_EQ(plan.get_stages()[0].details,
+              "buffered 4 elements in std::vector, 16 bytes on the heap, upstream consumed on construction, "
+              "dynamic extent");
+
+    const auto static_plan = stream(array).sort().explain();
+    ASSERT_EQ(static_plan.get_stages()[0].details,
+              "buffered 4 elements in std::array, 16 bytes inline, upstream consumed on construction, "
+              "static extent 4");
+    ASSERT_EQ(static_plan.get_stages()[1].details,
+              "for_each, reduce and collect_array unrolled over 4 elements, count() is a constant");
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <kstd/streams/materialized_view.hpp>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_materialized_view_collect) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {1, 2, 3, 4};
+    auto view = materialized_view(values, [](auto stream) {
+        return stream.filter(filters::even).map([](auto& value) { return value * 10; });
+    });
+
+    std::vector<kstd::u32> result(view.get().cbegin(), view.get().cend());
+    std::sort(result.begin(), result.end());
+    ASSERT_EQ(result, (std::vector<kstd::u32> {20, 40}));
+
+    values.push_back(6);
+    view.insert(6);
+    values.push_back(7);
+    view.insert(7);
+    view.erase(2);
+    view.update(4, 8);
+
+    result.assign(view.get().cbegin(), view.get().cend());
+    std::sort(result.begin(), result.end());
+    ASSERT_EQ(result, (std::vector<kstd::u32> {60, 80}));
+
+    // Removing an element which is in there several times only removes one of them
+    view.insert(6);
+    view.insert(6);
+    view.erase(6);
+    ASSERT_EQ(view.get().size(), 3);
+    ASSERT_EQ(view.get().count(60), 2);
+
+    static_assert(aggregators::RemovesAnyElement<decltype(aggregators::collect)>);
+    static_assert(!aggregators::RemovesAnyElement<decltype(aggregators::max)>);
+    static_assert(!aggregators::RemovesAnyElement<decltype(aggregators::fold(reducers::add))>);
+}
+
+TEST(kstd_streams_Stream, test_materialized_view_collect_unhashable) {
+    using namespace kstd::streams;
+
+    struct Point final {
+        kstd::i32 x;
+        kstd::i32 y;
+
+        [[nodiscard]] auto operator==(const Point&) const noexcept -> bool = default;
+    };
+
+    std::vector<kstd::i32> values {3, 1, 2};
+    auto view = materialized_view(values, [](auto stream) {
+        return stream.map([](auto& value) { return Point {value, -value}; });
+    });
+
+    // Without a hash, the results are kept in the order they were added
+    using State = std::remove_cvref_t<decltype(view.get())>;
+    static_assert(std::is_same_v<State, std::vector<Point>>);
+    ASSERT_EQ(view.get(), (std::vector<Point> {{3, -3}, {1, -1}, {2, -2}}));
+
+    view.insert(4);
+    view.erase(1);
+    view.update(3, 5);
+    ASSERT_EQ(view.get(), (std::vector<Point> {{2, -2}, {4, -4}, {5, -5}}));
+
+    static_assert(aggregators::Hashable<kstd::u32>);
+    static_assert(!aggregators::Hashable<Point>);
+}
+
+TEST(kstd_streams_Stream, test_materialized_view_sum_count) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5};
+    auto sum = materialized_view(values, [](auto stream) { return stream.filter(filters::odd); }, aggregators::sum);
+    auto count = materialized_view(values, [](auto stream) { return stream.filter(filters::odd); }, aggregators::count);
+    ASSERT_EQ(sum.get(), 9);
+    ASSERT_EQ(count.get(), 3);
+
+    sum.insert(7);
+    count.insert(7);
+    sum.insert(8);
+    count.insert(8);
+    ASSERT_EQ(sum.get(), 16);
+    ASSERT_EQ(count.get(), 4);
+
+    sum.update(1, 2);
+    count.update(1, 2);
+    sum.erase(3);
+    count.erase(3);
+    ASSERT_EQ(sum.get(), 12);
+    ASSERT_EQ(count.get(), 2);
+}
+
+TEST(kstd_streams_Stream, test_materialized_view_group_sum) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    struct Order final {
+        std::string customer;
+        kstd::u32 amount;
+    };
+
+    const std::vector<Order> orders {{"Alex"s, 10}, {"Sam"s, 5}, {"Alex"s, 7}};
+    auto totals = materialized_view(
+            orders, [](auto stream) { return stream.filter([](auto& order) { return order.amount > 0; }); },
+            aggregators::group_sum([](auto& order) { return order.customer; },
+                                   [](auto& order) { return order.amount; }));
+
+    ASSERT_EQ(totals.get().size(), 2);
+    ASSERT_EQ(totals.get().at("Alex").sum, 17);
+    ASSERT_EQ(totals.get().at("Alex").count, 2);
+    ASSERT_EQ(totals.get().at("Sam").sum, 5);
+
+    totals.erase({"Sam"s, 5});
+    totals.update({"Alex"s, 10}, {"Alex"s, 3});
+    totals.insert({"Kim"s, 1});
+    totals.insert({"Kim"s, 0});
+
+    ASSERT_EQ(totals.get().size(), 2);
+    ASSERT_FALSE(totals.get().contains("Sam"));
+    ASSERT_EQ(totals.get().at("Alex").sum, 10);
+    ASSERT_EQ(totals.get().at("Kim").count, 1);
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <kstd/streams/parallel.hpp>
+#include <kstd/streams/stream.hpp>
+#include <mutex>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_parallel) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u64> values {};
+    for(kstd::u64 value = 0; value < 100000; ++value) {
+        values.push_back(value);
+    }
+    const auto pipeline = [](auto stream) {
+        return stream.filter(filters::even).map([](auto& value) { return value * 3; });
+    };
+    const auto expected = stream(values).filter(filters::even).map([](auto& value) { return value * 3; }).sum();
+
+    for(const auto numa_aware : {false, true}) {
+        for(const kstd::usize threads : {1, 4}) {
+            const ParallelOptions options {threads, 1000, numa_aware};
+            ASSERT_EQ(parallel(values, pipeline, options).sum(), expected);
+            ASSERT_EQ(parallel(values, pipeline, options).count(), 50000);
+            ASSERT_EQ(parallel(values, pipeline, options).reduce(reducers::add, 7), expected + 7);
+
+            const auto collected = parallel(values, pipeline, options).collect();
+            ASSERT_EQ(collected.size(), 50000);
+            for(kstd::usize index = 0; index < collected.size(); ++index) {
+                ASSERT_EQ(collected[index], index * 6);
+            }
+        }
+    }
+
+    std::atomic<kstd::u64> sum {0};
+    parallel(values, ParallelOptions {4, 333}).for_each([&](auto& value) { sum += value; });
+    ASSERT_EQ(sum, stream(values).sum());
+    ASSERT_EQ(parallel(values).count(), values.size());
+}
+
+TEST(kstd_streams_Stream, test_parallel_numa_topology) {
+    using namespace kstd::streams;
+
+    ASSERT_EQ(detail::parse_cpu_list("0-3,8,10-11\n"), (std::vector<kstd::u32> {0, 1, 2, 3, 8, 10, 11}));
+    ASSERT_TRUE(detail::parse_cpu_list("").empty());
+
+    const auto& nodes = detail::get_numa_nodes();
+    ASSERT_FALSE(nodes.empty());
+
+    const std::vector<kstd::u32> values(1024, 1);
+    const auto memory_nodes = detail::get_memory_nodes({values.data()});
+    ASSERT_EQ(memory_nodes.size(), 1);
+    if(memory_nodes[0] != -1) {
+        ASSERT_TRUE(stream(nodes).find_first([&](auto& node) { return node.id == memory_nodes[0]; }));
+    }
+}
+
+TEST(kstd_streams_Stream, test_parallel_adaptive_grain_size) {
+    using namespace kstd::streams;
+
+    std::mutex mutex {};
+    std::vector<kstd::u32> values(1000, 1);
+    kstd::usize visited = 0;
+    parallel(values, ParallelOptions {4}).for_each([&](auto&) {
+        const std::scoped_lock lock {mutex};
+        ++visited;
+    });
+    ASSERT_EQ(visited, 1000);
+    ASSERT_EQ(parallel(values, ParallelOptions {4}).sum(), 1000);
+
+    // Too little work in total to be worth starting threads
+    kstd::usize num_threads = 4;
+    ASSERT_EQ(detail::pick_grain_size(1.0, 1000, num_threads), 50000);
+    ASSERT_EQ(num_threads, 1);
+
+    // Cheap elements, chunks take target_chunk_time
+    num_threads = 4;
+    ASSERT_EQ(detail::pick_grain_size(1.0, 10000000, num_threads), 50000);
+    ASSERT_EQ(num_threads, 4);
+
+    // Expensive elements, but at least chunks_per_thread chunks per worker
+    num_threads = 4;
+    ASSERT_EQ(detail::pick_grain_size(5000.0, 1000, num_threads), 10);
+    ASSERT_EQ(num_threads, 4);
+    ASSERT_EQ(detail::pick_grain_size(100.0, 10000, num_threads), 10000 / (4 * detail::chunks_per_thread));
+    ASSERT_EQ(detail::pick_grain_size(1000000.0, 1000, num_threads), 1);
+
+    // A given grain size skips sampling
+    const auto chunks = parallel(values, ParallelOptions {4, 10}).collect_chunks();
+    ASSERT_EQ(chunks.size(), 100);
+    for(const auto& chunk : chunks) {
+        ASSERT_EQ(chunk.size(), 10);
+    }
+
+    const auto doubled = [](auto stream) {
+        return stream.map([](auto& value) { return value * 2; });
+    };
+    ASSERT_EQ(parallel(values, doubled, ParallelOptions {4}).sum(), 2000);
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/streams/perf_counters.hpp>
+#include <kstd/streams/stream.hpp>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_perf_counters) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values {1, 2, 3, 4, 5};
+    bool invoked = false;
+    const auto sum = profiling::measure_hardware_counters(
+            [&]() {
+                return stream(values).filter(filters::odd).sum();
+            },
+            [&](const profiling::HardwareCounters& counters) {
+                invoked = true;
+                // Counters may legitimately be unavailable, e.g. in containers
+                if(counters.instructions) {
+                    ASSERT_GT(*counters.instructions, 0);
+                }
+            });
+
+    ASSERT_TRUE(invoked);
+    ASSERT_EQ(sum, 9);
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Node final {
+        kstd::u64 value;
+        Node* next;
+    };
+}// namespace
+
+TEST(kstd_streams_Stream, test_prefetch_deref_all) {
+    using namespace kstd::streams;
+
+    std::vector<std::unique_ptr<Node>> nodes {};
+    for(kstd::u64 index = 0; index < 1000; ++index) {
+        nodes.push_back(std::make_unique<Node>(Node {index, nullptr}));
+    }
+    std::vector<Node*> pointers {};
+    for(auto& node : nodes) {
+        pointers.push_back(node.get());
+    }
+    std::shuffle(pointers.begin(), pointers.end(), std::mt19937 {7});
+
+    std::vector<kstd::u64> expected {};
+    for(auto* pointer : pointers) {
+        expected.push_back(pointer->value);
+    }
+
+    // Random access sources are prefetched automatically
+    auto derefed = stream(pointers).deref_all();
+    ASSERT_NE(derefed.explain().to_string().find("prefetch"), std::string::npos);
+    ASSERT_EQ(derefed.map([](auto& node) { return node.value; }).collect<std::vector>(collectors::push_back),
+              expected);
+
+    const std::list<Node*> list(pointers.begin(), pointers.end());
+    auto list_derefed = stream(list).deref_all();
+    ASSERT_EQ(list_derefed.explain().to_string().find("prefetch"), std::string::npos);
+    ASSERT_EQ(list_derefed.count(), pointers.size());
+}
+
+TEST(kstd_streams_Stream, test_prefetch) {
+    using namespace kstd::streams;
+
+    std::vector<Node> nodes(100);
+    std::vector<Node*> pointers {};
+    for(kstd::u64 index = 0; index < nodes.size(); ++index) {
+        nodes[index] = {index, index + 1 < nodes.size() ? &nodes[index + 1] : nullptr};
+        pointers.push_back(&nodes[index]);
+    }
+    pointers.push_back(nullptr);
+
+    // The filter is no lookahead source, so the stage reads ahead into its buffer
+    for(const kstd::usize distance : {0, 1, 4, 16, 200}) {
+        std::vector<Node*> result {};
+        auto prefetched = stream(pointers)
+                                  .filter([](auto* pointer) { return pointer == nullptr || pointer->value % 3 != 0; })
+                                  .prefetch<&Node::next>(distance);
+        ASSERT_NE(prefetched.explain().to_string().find("reads ahead"), std::string::npos);
+        prefetched.for_each([&](auto* pointer) { result.push_back(pointer); });
+
+        std::vector<Node*> expected {};
+        std::copy_if(pointers.begin(), pointers.end(), std::back_inserter(expected), [](auto* pointer) {
+            return pointer == nullptr || pointer->value % 3 != 0;
+        });
+        ASSERT_EQ(result, expected);
+    }
+
+    auto peeking = stream(pointers).prefetch<&Node::value, &Node::next>(8);
+    ASSERT_NE(peeking.explain().to_string().find("peeks into its source"), std::string::npos);
+    ASSERT_EQ(peeking.count(), pointers.size());
+}
+
+TEST(kstd_streams_Stream, test_prefetch_until_empty) {
+    using namespace kstd::streams;
+
+    std::vector<Node> nodes(100);
+    for(kstd::u64 index = 0; index < nodes.size(); ++index) {
+        nodes[index] = {index, nullptr};
+    }
+
+    // Suppliers have no static extent and can not be peeked into, so the stage reads ahead
+    kstd::usize index = 0;
+    auto prefetched = stream_until_empty([&]() -> kstd::Option<Node*> {
+                          if(index == nodes.size()) {
+                              return {};
+                          }
+                          return &nodes[index++];
+                      }).prefetch<&Node::next>(8);
+    ASSERT_NE(prefetched.explain().to_string().find("reads ahead"), std::string::npos);
+
+    std::vector<kstd::u64> result {};
+    prefetched.for_each([&](auto* pointer) { result.push_back(pointer->value); });
+    ASSERT_EQ(result.size(), nodes.size());
+    for(kstd::u64 value = 0; value < result.size(); ++value) {
+        ASSERT_EQ(result[value], value);
+    }
+}
+
+TEST(kstd_streams_Stream, test_prefetch_until_null) {
+    using namespace kstd::streams;
+
+    std::vector<Node> nodes(100);
+    for(kstd::u64 index = 0; index < nodes.size(); ++index) {
+        nodes[index] = {index, index + 1 < nodes.size() ? &nodes[index + 1] : nullptr};
+    }
+
+    // The references of the linked list are buffered as pointers while the next nodes are fetched
+    for(const kstd::usize distance : {0, 1, 4, 200}) {
+        std::vector<const Node*> result {};
+        auto prefetched = stream_until_null(nodes.data(), KSTD_PTR_FIELD_FUNCTOR(next)).prefetch<&Node::next>(distance);
+        ASSERT_NE(prefetched.explain().to_string().find("reads ahead"), std::string::npos);
+        prefetched.for_each([&](auto& node) { result.push_back(&node); });
+
+        ASSERT_EQ(result.size(), nodes.size());
+        for(kstd::usize index = 0; index < nodes.size(); ++index) {
+            ASSERT_EQ(result[index], &nodes[index]);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <kstd/streams/resumable_task.hpp>
+#include <kstd/streams/stream.hpp>
+#include <utility>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_resumable_step) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 value = 0; value < 10000; ++value) {
+        values.push_back(value);
+    }
+
+    kstd::u64 sum = 0;
+    auto task = stream(values).filter(filters::even).resumable([&](auto& value) { sum += value; });
+    ASSERT_FALSE(task.step(1000));
+    ASSERT_EQ(task.get_processed(), 1000);
+    ASSERT_EQ(sum, 999000);
+
+    kstd::usize slices = 1;
+    auto moved = std::move(task);
+    while(!moved.step(1000)) {
+        ++slices;
+    }
+    ASSERT_EQ(slices, 5);
+    ASSERT_TRUE(moved.is_done());
+    ASSERT_EQ(moved.get_processed(), 5000);
+    ASSERT_EQ(sum, stream(values).filter(filters::even).reduce(reducers::add, kstd::u64 {}));
+}
+
+TEST(kstd_streams_Stream, test_resumable_run_for) {
+    using namespace kstd::streams;
+
+    const std::vector<kstd::u32> values(2000, 1);
+    auto task = stream(values).resumable([count = kstd::usize {0}](auto&) mutable {
+        const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds {10};
+        while(std::chrono::steady_clock::now() < end) {
+        }
+        ++count;
+    });
+
+    kstd::usize slices = 0;
+    while(!task.run_for(std::chrono::milliseconds {2})) {
+        ++slices;
+    }
+    ASSERT_GT(slices, 2);
+    ASSERT_EQ(task.get_processed(), 2000);
+    ASSERT_TRUE(task.run_for(std::chrono::milliseconds {1}));
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <kstd/streams/parallel.hpp>
+#include <kstd/streams/sketches.hpp>
+#include <kstd/streams/stream.hpp>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    // Zipf-like distribution, value n occurs about 1 / (n + 1) as often as value 0
+    auto make_skewed_values(kstd::usize size) -> std::vector<kstd::u32> {
+        std::mt19937 random {1337};
+        std::uniform_real_distribution<double> distribution {0.0, 1.0};
+        std::vector<kstd::u32> values(size);
+        for(auto& value : values) {
+            value = static_cast<kstd::u32>(std::exp(distribution(random) * std::log(10000.0))) - 1;
+        }
+        return values;
+    }
+
+    auto count_exactly(const std::vector<kstd::u32>& values) -> std::unordered_map<kstd::u32, kstd::u64> {
+        std::unordered_map<kstd::u32, kstd::u64> counts {};
+        for(const auto value : values) {
+            ++counts[value];
+        }
+        return counts;
+    }
+}// namespace
+
+TEST(kstd_streams_Stream, test_top_frequent) {
+    using namespace kstd::streams;
+
+    const auto values = make_skewed_values(100000);
+    const auto counts = count_exactly(values);
+    constexpr kstd::usize k = 64;
+
+    const auto summary = stream(values).top_frequent(k);
+    const auto elements = summary.get_elements();
+    ASSERT_EQ(elements.size(), k);
+    ASSERT_EQ(summary.get_total(), values.size());
+    for(const auto& element : elements) {
+        const auto count = counts.at(element.value);
+        ASSERT_GE(element.count, count);
+        ASSERT_LE(element.count - element.error, count);
+    }
+    ASSERT_EQ(elements.front().value, 0);
+
+    // Everything above total / k has to be tracked
+    for(const auto& [value, count] : counts) {
+        if(count > values.size() / k) {
+            ASSERT_GE(summary.estimate(value), count);
+            ASSERT_NE(std::find_if(elements.begin(), elements.end(),
+                                   [&](const auto& element) {
+                                       return element.value == value;
+                                   }),
+                      elements.end());
+        }
+    }
+
+    const std::vector<std::string> words {"to", "be", "or", "not", "to", "be"};
+    const auto top_words = stream(words).top_frequent(4, [](auto& word) { return word; }).get_elements();
+    ASSERT_EQ(top_words.size(), 4);
+    ASSERT_EQ(top_words[0].count, 2);
+    ASSERT_EQ(top_words[1].count, 2);
+    ASSERT_EQ(top_words[2].count, 1);
+}
+
+TEST(kstd_streams_Stream, test_top_frequent_merge) {
+    using namespace kstd::streams;
+
+    const auto values = make_skewed_values(100000);
+    const auto counts = count_exactly(values);
+    constexpr kstd::usize k = 64;
+
+    const std::vector<kstd::u32> first(values.begin(), values.begin() + 30000);
+    const std::vector<kstd::u32> second(values.begin() + 30000, values.end());
+    auto summary = stream(first).top_frequent(k);
+    summary.merge(stream(second).top_frequent(k));
+    const auto parallel_summary = parallel(values, ParallelOptions {.threads = 4, .grain_size = 10000}).top_frequent(k);
+    // Thousands of tiny chunks still end up in one summary per worker
+    const auto fine_summary = parallel(values, ParallelOptions {.threads = 4, .grain_size = 16}).top_frequent(k);
+
+    for(const auto& merged : {summary, parallel_summary, fine_summary}) {
+        ASSERT_EQ(merged.get_total(), values.size());
+        ASSERT_LE(merged.get_size(), k);
+        for(const auto& element : merged.get_elements()) {
+            const auto count = counts.at(element.value);
+            ASSERT_GE(element.count, count);
+            ASSERT_LE(element.count - element.error, count);
+        }
+        for(const auto& [value, count] : counts) {
+            if(count > values.size() / k) {
+                ASSERT_GE(merged.estimate(value), count);
+            }
+        }
+    }
+}
+
+TEST(kstd_streams_Stream, test_frequency_sketch) {
+    using namespace kstd::streams;
+
+    const auto values = make_skewed_values(100000);
+    const auto counts = count_exactly(values);
+
+    const auto sketch = stream(values).frequency_sketch(2048, 4);
+    ASSERT_EQ(sketch.get_total(), values.size());
+    kstd::usize accurate = 0;
+    for(const auto& [value, count] : counts) {
+        const auto estimate = sketch.estimate(value);
+        ASSERT_GE(estimate, count);
+        if(estimate - count <= values.size() * 3 / 2048) {
+            ++accurate;
+        }
+    }
+    ASSERT_GE(accurate * 100, counts.size() * 95);
+
+    const std::vector<kstd::u32> first(values.begin(), values.begin() + 50000);
+    const std::vector<kstd::u32> second(values.begin() + 50000, values.end());
+    auto merged = stream(first).frequency_sketch(2048, 4);
+    ASSERT_TRUE(merged.merge(stream(second).frequency_sketch(2048, 4)));
+    ASSERT_FALSE(merged.merge(stream(values).frequency_sketch(1024, 4)));
+    const auto parallel_sketch = parallel(values, ParallelOptions {.threads = 4}).frequency_sketch(2048, 4);
+    for(const auto& [value, count] : counts) {
+        ASSERT_EQ(merged.estimate(value), sketch.estimate(value));
+        ASSERT_EQ(parallel_sketch.estimate(value), sketch.estimate(value));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <string>
+#include <vector>
+
+struct SomeRecord final {
+    kstd::u32 id;
+    kstd::f32 x;
+    kstd::f32 y;
+    std::string name;
+};
+
+struct SomeRecordView final {
+    kstd::u32& id;
+    kstd::f32& x;
+    kstd::f32& y;
+};
+
+TEST(kstd_streams_Stream, test_collect_soa) {
+    using namespace kstd::streams;
+    using namespace std::string_literals;
+
+    const std::vector<SomeRecord> values {{1, 1.0F, 2.0F, "Hello"s},
+                                          {2, 3.0F, 4.0F, "World"s},
+                                          {3, 5.0F, 6.0F, "OwO"s}};
+    const auto [ids, xs] = stream(values).collect_soa<&SomeRecord::id, &SomeRecord::x>();
+    const auto num_values = values.size();
+    ASSERT_EQ(ids.size(), num_values);
+    ASSERT_EQ(xs.size(), num_values);
+
+    for(kstd::usize index = 0; index < num_values; ++index) {
+        ASSERT_EQ(ids[index], values[index].id);
+        ASSERT_EQ(xs[index], values[index].x);
+    }
+}
+
+TEST(kstd_streams_Stream, test_collect_soa_filtered) {
+    using namespace kstd::streams;
+
+    std::vector<SomeRecord> values {};
+    for(kstd::u32 id = 0; id < 1000; ++id) {
+        values.push_back({id, 1.0F, 2.0F, {}});
+    }
+    // A filter gives no size hint, so the columns are not sized for every upstream record
+    // clang-format off
+    const auto [ids, xs] = stream(values)
+        .filter([](auto& value) { return value.id == 7; })
+        .collect_soa<&SomeRecord::id, &SomeRecord::x>();
+    // clang-format on
+    ASSERT_EQ(ids.size(), 1);
+    ASSERT_EQ(ids[0], 7);
+    ASSERT_LT(ids.capacity(), values.size());
+    ASSERT_LT(xs.capacity(), values.size());
+}
+
+TEST(kstd_streams_Stream, test_stream_soa_tuple) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> ids {1, 2, 3, 4};
+    std::vector<kstd::f32> xs {1.0F, 2.0F, 3.0F, 4.0F};
+    // clang-format off
+    const auto sum = stream_soa(ids, xs)
+        .filter([](auto& value) { return std::get<0>(value) > 2; })
+        .map([](auto& value) { return std::get<1>(value); })
+        .sum();
+    // clang-format on
+    ASSERT_EQ(sum, 7.0F);
+}
+
+TEST(kstd_streams_Stream, test_stream_soa_view) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> ids {1, 2, 3, 4};
+    std::vector<kstd::f32> xs {1.0F, 2.0F, 3.0F, 4.0F};
+    std::vector<kstd::f32> ys {5.0F, 6.0F, 7.0F, 8.0F};
+    // clang-format off
+    const auto sum = stream_soa<SomeRecordView>(ids, xs, ys)
+        .map(KSTD_FIELD_FUNCTOR(y))
+        .sum();
+    // clang-format on
+    ASSERT_EQ(sum, 26.0F);
+
+    stream_soa<SomeRecordView>(ids, xs, ys).for_each([](auto& value) {
+        value.x *= 2.0F;
+    });
+    ASSERT_EQ(xs[3], 8.0F);
+
+    const auto [collected_ids, collected_ys] = stream_soa<SomeRecordView>(ids, xs, ys)
+        .collect_soa<KSTD_FIELD_FUNCTOR(id), KSTD_FIELD_FUNCTOR(y)>();
+    ASSERT_EQ(collected_ids, ids);
+    ASSERT_EQ(collected_ys, ys);
+}
+
+TEST(kstd_streams_Stream, test_stream_soa_find) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> ids {1, 2, 3, 4};
+    std::vector<kstd::f32> xs {1.0F, 2.0F, 3.0F, 4.0F};
+    std::vector<kstd::f32> ys {5.0F, 6.0F, 7.0F, 8.0F};
+
+    // Each view stays bound to its own row, even after the stream is gone
+    const auto last = stream_soa<SomeRecordView>(ids, xs, ys).find_last([](auto& value) { return value.id % 2 == 1; });
+    ASSERT_TRUE(last);
+    ASSERT_EQ(&last->id, &ids[2]);
+    ASSERT_EQ(last->y, 7.0F);
+
+    const auto first = stream_soa(ids, xs).find_first([](auto& value) { return std::get<0>(value) > 1; });
+    ASSERT_TRUE(first);
+    ASSERT_EQ(&std::get<1>(*first), &xs[1]);
+
+    const auto last_tuple = stream_soa(ids, xs).find_last([](auto& value) { return std::get<0>(value) < 3; });
+    ASSERT_TRUE(last_tuple);
+    ASSERT_EQ(&std::get<0>(*last_tuple), &ids[1]);
+    ASSERT_EQ(ids, (std::vector<kstd::u32> {1, 2, 3, 4}));
+}
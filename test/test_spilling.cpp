@@ -0,0 +1,216 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <kstd/streams/spilling.hpp>
+#include <kstd/streams/stream.hpp>
+#include <limits>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+    // Stands in for a full disk or a broken file by failing the stream after a number of elements
+    struct FlakyValue final {
+        kstd::u32 value;
+
+        [[nodiscard]] auto operator==(const FlakyValue& other) const noexcept -> bool = default;
+    };
+
+    kstd::usize flaky_writes_left = 0;
+    kstd::usize flaky_reads_left = 0;
+}// namespace
+
+template<>
+struct std::hash<FlakyValue> final {
+    [[nodiscard]] auto operator()(const FlakyValue& value) const noexcept -> kstd::usize {
+        return std::hash<kstd::u32> {}(value.value);
+    }
+};
+
+template<>
+struct kstd::streams::detail::SpillCodec<FlakyValue> final {
+    static auto write(std::ostream& stream, const FlakyValue& value) -> void {
+        if(flaky_writes_left == 0) {
+            stream.setstate(std::ios::badbit);
+            return;
+        }
+        --flaky_writes_left;
+        SpillCodec<kstd::u32>::write(stream, value.value);
+    }
+
+    [[nodiscard]] static auto read(std::istream& stream) -> kstd::Option<FlakyValue> {
+        if(flaky_reads_left == 0) {
+            return {};
+        }
+        --flaky_reads_left;
+        const auto value = SpillCodec<kstd::u32>::read(stream);
+        if(!value) {
+            return {};
+        }
+        return FlakyValue {*value};
+    }
+
+    [[nodiscard]] static constexpr auto get_heap_size(const FlakyValue&) noexcept -> kstd::usize {
+        return 0;
+    }
+};
+
+namespace {
+    auto count_spill_files(const std::filesystem::path& directory) -> kstd::usize {
+        kstd::usize count = 0;
+        for(const auto& entry : std::filesystem::directory_iterator {directory}) {
+            count += entry.path().filename().string().starts_with("kstd-streams-spill-") ? 1 : 0;
+        }
+        return count;
+    }
+}// namespace
+
+TEST(kstd_streams_Stream, test_distinct_memory_budget) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 value = 0; value < 20000; ++value) {
+        values.push_back((value * 7919) % 5000);
+    }
+
+    const auto directory = std::filesystem::temp_directory_path();
+    const auto files_before = count_spill_files(directory);
+    auto distinct = stream(values).distinct(MemoryBudget {4096});
+    std::unordered_set<kstd::u32> result {};
+    kstd::usize count = 0;
+    distinct.for_each([&](auto value) {
+        result.insert(value);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 5000);
+    ASSERT_EQ(result.size(), 5000);
+    ASSERT_EQ(distinct.explain().to_string().find(" 0 partitions spilled"), std::string::npos);
+    ASSERT_EQ(count_spill_files(directory), files_before);
+}
+
+TEST(kstd_streams_Stream, test_distinct_memory_budget_strings) {
+    using namespace kstd::streams;
+
+    std::vector<std::string> values {};
+    for(kstd::u32 value = 0; value < 3000; ++value) {
+        values.push_back("value number " + std::to_string(value % 1000));
+    }
+
+    auto distinct = stream(values).distinct(MemoryBudget {2048});
+    std::unordered_set<std::string> result {};
+    kstd::usize count = 0;
+    distinct.for_each([&](auto& value) {
+        result.insert(value);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 1000);
+    ASSERT_EQ(result.size(), 1000);
+    ASSERT_TRUE(result.contains("value number 999"));
+
+    // Anything else can't be written to disk, which budgeted stages reject up front
+    struct Named final {
+        std::string name;
+    };
+    static_assert(detail::Spillable<kstd::u64>);
+    static_assert(detail::Spillable<std::pair<std::string, kstd::u32>>);
+    static_assert(!detail::Spillable<Named>);
+    static_assert(!detail::Spillable<std::pair<std::string, Named>>);
+    static_assert(!detail::Spillable<std::vector<kstd::u32>>);
+}
+
+TEST(kstd_streams_Stream, test_group_by) {
+    using namespace kstd::streams;
+
+    struct Order final {
+        std::string customer;
+        kstd::u32 amount;
+    };
+
+    std::vector<Order> orders {};
+    std::map<std::string, kstd::u32> expected {};
+    for(kstd::u32 index = 0; index < 4000; ++index) {
+        auto customer = "customer " + std::to_string((index * 31) % 700);
+        expected[customer] += index;
+        orders.push_back({std::move(customer), index});
+    }
+
+    for(const kstd::usize budget : {kstd::usize {1024}, std::numeric_limits<kstd::usize>::max()}) {
+        std::map<std::string, kstd::u32> result {};
+        stream(orders)
+                .group_by(&Order::customer, &Order::amount, reducers::add, MemoryBudget {budget})
+                .for_each([&](auto& group) { result.emplace(group.first, group.second); });
+        ASSERT_EQ(result, expected);
+    }
+
+    ASSERT_EQ(stream(orders).group_by(&Order::customer, &Order::amount, reducers::add).count(), 700);
+}
+
+TEST(kstd_streams_Stream, test_distinct_unwritable_directory) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::u32> values {};
+    for(kstd::u32 value = 0; value < 20000; ++value) {
+        values.push_back((value * 7919) % 5000);
+    }
+
+    // A regular file can not hold the partition files, so every partition stays in memory
+    const auto file = std::filesystem::temp_directory_path() / "kstd-streams-not-a-directory";
+    std::ofstream {file}.put('x');
+    const auto directory = file.string();
+    auto distinct = stream(values).distinct(MemoryBudget {4096, directory.c_str()});
+    std::unordered_set<kstd::u32> result {};
+    distinct.for_each([&](auto value) { ASSERT_TRUE(result.insert(value).second); });
+    std::filesystem::remove(file);
+
+    ASSERT_EQ(result.size(), 5000);
+    ASSERT_FALSE(distinct.has_failed());
+    ASSERT_NE(distinct.explain().to_string().find(" 0 partitions spilled"), std::string::npos);
+}
+
+TEST(kstd_streams_Stream, test_distinct_failing_spill_stream) {
+    using namespace kstd::streams;
+
+    std::vector<FlakyValue> values {};
+    for(kstd::u32 value = 0; value < 20000; ++value) {
+        values.push_back({(value * 7919) % 5000});
+    }
+
+    // Writes start failing part way through, so the partitions written so far are read back into memory
+    flaky_writes_left = 3000;
+    flaky_reads_left = std::numeric_limits<kstd::usize>::max();
+    auto distinct = stream(values).distinct(MemoryBudget {4096});
+    std::unordered_set<FlakyValue> result {};
+    distinct.for_each([&](auto value) { ASSERT_TRUE(result.insert(value).second); });
+    ASSERT_EQ(result.size(), 5000);
+    ASSERT_FALSE(distinct.has_failed());
+
+    // Elements which can not be read back are lost, which the stream reports
+    flaky_writes_left = std::numeric_limits<kstd::usize>::max();
+    flaky_reads_left = 1000;
+    auto lossy = stream(values).distinct(MemoryBudget {4096});
+    ASSERT_LT(lossy.count(), 5000);
+    ASSERT_TRUE(lossy.has_failed());
+}
\ No newline at end of file
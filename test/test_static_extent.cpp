@@ -0,0 +1,115 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <memory>
+#include <span>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_static_extent) {
+    using namespace kstd::streams;
+
+    std::array<kstd::u32, 4> array {1, 2, 3, 4};
+    kstd::u32 c_array[3] {1, 2, 3};// NOLINT
+    std::span<kstd::u32, 4> span {array};
+    std::vector<kstd::u32> vector {1, 2, 3};
+
+    static_assert(decltype(stream(array))::extent == 4);
+    static_assert(decltype(stream(c_array))::extent == 3);
+    static_assert(decltype(stream(span))::extent == 4);
+    static_assert(decltype(iota<0, 8>())::extent == 8);
+    static_assert(decltype(stream(vector))::extent == dynamic_extent);
+    static_assert(decltype(stream(array).map(mappers::address_of))::extent == 4);
+    static_assert(decltype(stream(array).sort())::extent == 4);
+    static_assert(decltype(stream(array).filter(filters::odd))::extent == dynamic_extent);
+    static_assert(decltype(stream(array).distinct())::extent == dynamic_extent);
+
+    ASSERT_EQ(stream(array).count(), 4);
+    ASSERT_EQ(stream(c_array).sum(), 6);
+    ASSERT_EQ(stream(span).map([](auto& value) { return value * 2; }).sum(), 20);
+    ASSERT_EQ(stream(array).filter(filters::odd).count(), 2);
+}
+
+TEST(kstd_streams_Stream, test_static_extent_iota) {
+    using namespace kstd::streams;
+
+    static_assert(iota<0, 5>().sum() == 10);
+    static_assert(iota<0, 5>().count() == 5);
+    const auto num_even = iota<0, 100>().filter(filters::even).count();
+    ASSERT_EQ(num_even, 50);
+    const auto sum = iota<0, 100>().sum();
+    ASSERT_EQ(sum, 4950);
+}
+
+TEST(kstd_streams_Stream, test_static_extent_iota_find) {
+    using namespace kstd::streams;
+
+    // The values are yielded by copy, so neither result moves along with the cursor
+    const auto first = iota<0, 10>().find_first(filters::odd);
+    const auto last = iota<0, 10>().find_last(filters::even);
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(last);
+    ASSERT_EQ(*first, 1);
+    ASSERT_EQ(*last, 8);
+}
+
+TEST(kstd_streams_Stream, test_static_extent_sort) {
+    using namespace kstd::streams;
+
+    const std::array<kstd::u32, 6> values {4, 5, 6, 1, 3, 2};
+    const auto sorted_values = stream(values).sort().collect_array();
+    static_assert(std::is_same_v<std::remove_const_t<decltype(sorted_values)>, std::array<kstd::u32, 6>>);
+
+    for(kstd::usize index = 0; index < sorted_values.size(); ++index) {
+        ASSERT_EQ(sorted_values[index], index + 1);
+    }
+}
+
+TEST(kstd_streams_Stream, test_static_extent_sort_large) {
+    using namespace kstd::streams;
+
+    // Far more than fits on the stack, so the sort has to buffer on the heap
+    constexpr kstd::usize num_values = 4'000'000;
+    const auto values = std::make_unique<std::array<kstd::u32, num_values>>();
+    for(kstd::usize index = 0; index < num_values; ++index) {
+        (*values)[index] = static_cast<kstd::u32>(num_values - index);
+    }
+
+    const auto sorted_values = stream(*values).sort().collect<std::vector>(collectors::push_back);
+    ASSERT_EQ(sorted_values.size(), num_values);
+
+    for(kstd::usize index = 0; index < num_values; ++index) {
+        ASSERT_EQ(sorted_values[index], index + 1);
+    }
+}
+
+TEST(kstd_streams_Stream, test_static_extent_for_each) {
+    using namespace kstd::streams;
+
+    std::array<kstd::u32, 3> values {1, 2, 3};
+    stream(values).for_each([](auto& value) {
+        value *= 2;
+    });
+    ASSERT_EQ(values[0], 2);
+    ASSERT_EQ(values[1], 4);
+    ASSERT_EQ(values[2], 6);
+}
\ No newline at end of file
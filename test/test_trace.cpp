@@ -0,0 +1,115 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <kstd/streams/trace.hpp>
+#include <memory>
+#include <set>
+#include <span>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_trace_threads) {
+    using namespace kstd::streams;
+
+    constexpr kstd::usize num_threads = 4;
+    constexpr kstd::usize chunk_size = 256;
+    std::vector<kstd::u64> values(num_threads * chunk_size, 1);
+    std::vector<kstd::u64> sums(num_threads, 0);
+
+    profiling::TraceRecorder recorder {};
+    profiling::TraceRecorder::set_active(&recorder);
+
+    std::vector<std::thread> threads {};
+    for(kstd::usize index = 0; index < num_threads; ++index) {
+        threads.emplace_back([&, index] {
+            const std::span<kstd::u64> chunk {values.data() + index * chunk_size, chunk_size};
+            sums[index] = profiling::trace("process chunk", [&] { return stream(chunk).sum(); });
+            profiling::trace_instant("chunk done");
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+    profiling::TraceRecorder::set_active(nullptr);
+    profiling::trace_instant("ignored");
+
+    for(const auto sum : sums) {
+        ASSERT_EQ(sum, chunk_size);
+    }
+
+    const auto events = recorder.get_events();
+    ASSERT_EQ(events.size(), num_threads * 2);
+    std::set<kstd::u32> thread_ids {};
+    for(kstd::usize index = 0; index < events.size(); ++index) {
+        thread_ids.insert(events[index].thread);
+        if(index > 0) {
+            ASSERT_LE(events[index - 1].begin, events[index].begin);
+        }
+    }
+    ASSERT_EQ(thread_ids.size(), num_threads);
+
+    std::ostringstream trace {};
+    recorder.write_chrome_trace(trace);
+    const auto json = trace.str();
+    ASSERT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0);
+    ASSERT_NE(json.find("\"name\":\"process chunk\",\"cat\":\"stream\",\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"chunk done\",\"cat\":\"stream\",\"ph\":\"i\""), std::string::npos);
+    ASSERT_EQ(json.find("ignored"), std::string::npos);
+    ASSERT_EQ(json.back(), '}');
+}
+
+TEST(kstd_streams_Stream, test_trace_span_outliving_recorder) {
+    using namespace kstd::streams;
+
+    profiling::TraceRecorder first {};
+    profiling::TraceRecorder::set_active(&first);
+    {
+        const profiling::TraceSpan outer {"outer"};
+        {
+            const profiling::TraceSpan inner {"inner"};
+            ASSERT_EQ(first.get_open_spans(), 2);
+        }
+        ASSERT_EQ(first.get_events().size(), 1);
+    }
+    ASSERT_EQ(first.get_events().size(), 2);
+    ASSERT_EQ(first.get_open_spans(), 0);
+
+    // Spans whose recorder was swapped out or destroyed while they were open are dropped
+    auto second = std::make_unique<profiling::TraceRecorder>();
+    profiling::TraceRecorder::set_active(second.get());
+    auto span = std::make_unique<profiling::TraceSpan>("swapped");
+    profiling::TraceRecorder::set_active(&first);
+    ASSERT_EQ(second->get_open_spans(), 1);
+    span.reset();
+    ASSERT_TRUE(second->get_events().empty());
+    ASSERT_EQ(second->get_open_spans(), 0);// The room of the dropped span is given back
+
+    profiling::TraceRecorder::set_active(second.get());
+    span = std::make_unique<profiling::TraceSpan>("destroyed");
+    second.reset();
+    span.reset();
+
+    profiling::TraceRecorder::set_active(nullptr);
+    ASSERT_EQ(first.get_events().size(), 2);
+    ASSERT_EQ(first.get_open_spans(), 0);
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+// Copyright 2023 Karma Krafts & associates
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @author Alexander Hinze
+ * @since 18/10/2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <kstd/streams/stream.hpp>
+#include <kstd/streams/window_pipe.hpp>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(kstd_streams_Stream, test_sliding_window_aggregate) {
+    using namespace kstd::streams;
+
+    std::vector<kstd::i32> values(500);
+    std::mt19937 random {42};
+    std::generate(values.begin(), values.end(), [&] { return static_cast<kstd::i32>(random() % 1000) - 500; });
+
+    constexpr kstd::usize window = 7;
+    std::vector<kstd::i32> sums {};
+    std::vector<kstd::i32> maxima {};
+    std::vector<kstd::i32> minima {};
+    for(kstd::usize end = window; end <= values.size(); ++end) {
+        const auto begin = values.begin() + static_cast<std::ptrdiff_t>(end - window);
+        const auto last = values.begin() + static_cast<std::ptrdiff_t>(end);
+        sums.push_back(std::accumulate(begin, last, 0));
+        maxima.push_back(*std::max_element(begin, last));
+        minima.push_back(*std::min_element(begin, last));
+    }
+
+    const auto collect = [&](auto aggregator) {
+        return stream(values).sliding_window_aggregate(window, aggregator).template collect<std::vector>(
+                collectors::push_back);
+    };
+    ASSERT_EQ(collect(aggregators::sum), sums);
+    ASSERT_EQ(collect(aggregators::max), maxima);
+    ASSERT_EQ(collect(aggregators::min), minima);
+    ASSERT_EQ(collect(aggregators::fold(reducers::add)), sums);
+    ASSERT_EQ(collect(aggregators::fold([](auto& a, auto& b) { return std::max(a, b); })), maxima);
+
+    const auto means = collect(aggregators::mean);
+    ASSERT_EQ(means.size(), sums.size());
+    for(kstd::usize index = 0; index < means.size(); ++index) {
+        ASSERT_DOUBLE_EQ(means[index], static_cast<kstd::f64>(sums[index]) / window);
+    }
+    ASSERT_EQ(stream(values).sliding_window_aggregate(values.size() + 1, aggregators::sum).count(), 0);
+
+    // One aggregate per element once the first window is full
+    using Iterator = typename std::vector<kstd::i32>::iterator;
+    SlidingWindowPipe pipe {IteratorPipe<Iterator> {values.begin(), values.end()}, window, aggregators::sum};
+    ASSERT_EQ(pipe.get_size_hint(), sums.size());
+    ASSERT_TRUE(pipe.get_next());
+    ASSERT_EQ(pipe.get_size_hint(), sums.size() - 1);
+
+    // Copying the whole multiset for every element would cost the size of the window each time
+    static_assert(aggregators::HasCheapResult<decltype(aggregators::sum), kstd::i32>);
+    static_assert(aggregators::HasCheapResult<decltype(aggregators::max), kstd::i32>);
+    static_assert(!aggregators::HasCheapResult<decltype(aggregators::collect), kstd::i32>);
+}
+
+TEST(kstd_streams_Stream, test_tumbling_window) {
+    using namespace kstd::streams;
+
+    struct Sample final {
+        kstd::u32 timestamp;
+        kstd::u32 value;
+
+        [[nodiscard]] auto get_minute() const noexcept -> kstd::u32 {
+            return timestamp / 60;
+        }
+    };
+
+    std::vector<Sample> samples {};
+    for(kstd::u32 timestamp = 0; timestamp < 300; timestamp += 7) {
+        samples.push_back({timestamp, timestamp % 11});
+    }
+
+    std::vector<std::pair<kstd::u32, kstd::usize>> counts {};
+    stream(samples).tumbling_window(&Sample::get_minute, aggregators::count).for_each([&](auto& window) {
+        counts.push_back(window);
+    });
+    ASSERT_EQ(counts.size(), 5);
+    kstd::usize total = 0;
+    for(kstd::u32 minute = 0; minute < 5; ++minute) {
+        ASSERT_EQ(counts[minute].first, minute);
+        total += counts[minute].second;
+    }
+    ASSERT_EQ(total, samples.size());
+
+    const std::vector<kstd::u32> values {1, 1, 2, 2, 2, 1};
+    std::vector<std::pair<kstd::u32, kstd::u32>> sums {};
+    stream(values)
+            .tumbling_window([](auto& value) { return value; }, aggregators::sum)
+            .for_each([&](auto& window) { sums.push_back(window); });
+    ASSERT_EQ(sums, (std::vector<std::pair<kstd::u32, kstd::u32>> {{1, 2}, {2, 6}, {1, 1}}));
+}
+
+TEST(kstd_streams_Stream, test_tumbling_window_time) {
+    using namespace kstd::streams;
+
+    kstd::u32 next = 0;
+    kstd::usize windows = 0;
+    kstd::usize total = 0;
+    stream_until_empty([&]() -> kstd::Option<kstd::u32> {
+        if(next == 30) {
+            return {};
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds {1});
+        return next++;
+    })
+            .tumbling_window(std::chrono::milliseconds {10}, aggregators::count)
+            .for_each([&](auto& window) {
+                ++windows;
+                total += window.second;
+            });
+    ASSERT_GT(windows, 1);
+    ASSERT_EQ(total, 30);
+}
+
+TEST(kstd_streams_Stream, test_tumbling_window_timed_supplier) {
+    using namespace kstd::streams;
+    using Clock = std::chrono::steady_clock;
+
+    kstd::u32 calls = 0;
+    std::vector<std::pair<kstd::usize, kstd::usize>> windows {};
+    std::vector<Clock::duration> waits {};
+    kstd::usize windows_while_idle = 0;
+    stream_until_empty_timed([&](Clock::time_point deadline) -> kstd::Option<kstd::u32> {
+        switch(calls++) {
+            case 0: return 0;
+            case 1:
+                // Nothing arrives before the period ends, so the open window is emitted at its deadline
+                waits.push_back(deadline - Clock::now());
+                std::this_thread::sleep_until(deadline);
+                return {};
+            case 2:
+                windows_while_idle = windows.size();
+                waits.push_back(deadline - Clock::now());
+                return 1;
+            default: return {};// Closed before the deadline, which ends the stream
+        }
+    })
+            .tumbling_window(std::chrono::milliseconds {5}, aggregators::count)
+            .for_each([&](auto& window) { windows.push_back(window); });
+
+    ASSERT_EQ(windows_while_idle, 1);
+    ASSERT_EQ(windows.size(), 2);
+    ASSERT_EQ(windows[0].second, 1);
+    ASSERT_GT(windows[1].first, windows[0].first);
+    ASSERT_EQ(windows[1].second, 1);
+    ASSERT_EQ(waits.size(), 2);
+    ASSERT_LE(waits[0], std::chrono::milliseconds {5});
+    ASSERT_GT(waits[1], std::chrono::hours {1});// Without an open window there is no deadline
+    ASSERT_EQ(calls, 4);
+}
\ No newline at end of file